@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: add_cycles.cpp
+ * Description:
+ *  Measures the cost of `Frac::operator+` in CPU cycles (timestamp counter
+ *  ticks on x86, nanoseconds elsewhere). The "before" row reproduces the
+ *  original divide-based overflow detection so the two can be compared on the
+ *  same machine; the "after" row is the library operator built on the
+ *  compiler overflow builtins.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_add_cycles`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define BENCH_UNIT "cycles"
+    static std::uint64_t ticks() { return __rdtsc(); }
+#else
+    #define BENCH_UNIT "ns"
+    static std::uint64_t ticks() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+#endif
+
+namespace {
+    // The overflow checks FracLib used before switching to compiler builtins.
+    bool legacyMulOverflow(int a, int b) {
+        if (a == 0 || b == 0) return false;
+        if (a == -1 && b == std::numeric_limits<int>::min()) return true;
+        if (b == -1 && a == std::numeric_limits<int>::min()) return true;
+        int result = a * b;
+        return result / b != a;
+    }
+
+    bool legacyAddOverflow(int a, int b) {
+        if (b > 0 && a > std::numeric_limits<int>::max() - b) return true;
+        if (b < 0 && a < std::numeric_limits<int>::min() - b) return true;
+        return false;
+    }
+
+    FracLib::Frac legacyAdd(const FracLib::Frac& a, const FracLib::Frac& b) {
+        if (legacyMulOverflow(a.numerator, b.denominator) ||
+            legacyMulOverflow(b.numerator, a.denominator) ||
+            legacyMulOverflow(a.denominator, b.denominator) ||
+            legacyAddOverflow(a.numerator * b.denominator, b.numerator * a.denominator)) {
+            throw std::overflow_error(FracLib::Frac::OVERFLOW_ERROR);
+        }
+        return FracLib::Frac(a.numerator * b.denominator + b.numerator * a.denominator, a.denominator * b.denominator);
+    }
+
+    struct Operand {
+        int numerator;
+        int denominator;
+    };
+
+    template <typename AddFn>
+    double measure(const std::vector<Operand>& lhs, const std::vector<Operand>& rhs, AddFn add) {
+        constexpr int ROUNDS = 50;
+        long long sink = 0;
+        std::uint64_t best = std::numeric_limits<std::uint64_t>::max();
+        for (int round = 0; round < ROUNDS; round++) {
+            const std::uint64_t start = ticks();
+            for (std::size_t i = 0; i < lhs.size(); i++) {
+                FracLib::Frac a(lhs[i].numerator, lhs[i].denominator);
+                FracLib::Frac b(rhs[i].numerator, rhs[i].denominator);
+                FracLib::Frac result = add(a, b);
+                sink += result.numerator ^ result.denominator;
+            }
+            const std::uint64_t elapsed = ticks() - start;
+            if (elapsed < best) best = elapsed;
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(best) / static_cast<double>(lhs.size());
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 16;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-1000, 1000);
+    std::uniform_int_distribution<int> denominators(1, 1000);
+
+    std::vector<Operand> lhs, rhs;
+    lhs.reserve(COUNT);
+    rhs.reserve(COUNT);
+    for (std::size_t i = 0; i < COUNT; i++) {
+        lhs.push_back({numerators(rng), denominators(rng)});
+        rhs.push_back({numerators(rng), denominators(rng)});
+    }
+
+    const double before = measure(lhs, rhs, [](FracLib::Frac& a, const FracLib::Frac& b) { return legacyAdd(a, b); });
+    const double after = measure(lhs, rhs, [](FracLib::Frac& a, const FracLib::Frac& b) { return a + b; });
+
+    std::printf("operator+ (divide-based checks): %6.2f %s/op\n", before, BENCH_UNIT);
+    std::printf("operator+ (builtin checks):      %6.2f %s/op\n", after, BENCH_UNIT);
+    return 0;
+}
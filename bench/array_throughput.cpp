@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: array_throughput.cpp
+ * Description:
+ *  Measures element-wise addition of two arrays of fractions: a loop of
+ *  `Frac::operator+` over `std::vector<Frac>` versus `FracArray::add`. The
+ *  kernel name printed shows which instruction set was selected for this CPU.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_array_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_array.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename AddFn>
+    double measure(std::size_t count, AddFn add) {
+        constexpr int ROUNDS = 20;
+        double best = 1e30;
+        long long sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            sink += add();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(count) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 18;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-1000, 1000);
+    std::uniform_int_distribution<int> denominators(1, 1000);
+
+    std::vector<FracLib::Frac> lhs(COUNT), rhs(COUNT), sums(COUNT);
+    FracLib::FracArray lhsArray, rhsArray, sumArray;
+    for (std::size_t i = 0; i < COUNT; i++) {
+        lhs[i] = FracLib::Frac(numerators(rng), denominators(rng));
+        rhs[i] = FracLib::Frac(numerators(rng), denominators(rng));
+        lhsArray.push_back(lhs[i]);
+        rhsArray.push_back(rhs[i]);
+    }
+
+    const double before = measure(COUNT, [&]() {
+        for (std::size_t i = 0; i < COUNT; i++) sums[i] = lhs[i] + rhs[i];
+        return static_cast<long long>(sums[COUNT / 2].numerator);
+    });
+    const double after = measure(COUNT, [&]() {
+        FracLib::FracArray::add(lhsArray, rhsArray, sumArray);
+        return static_cast<long long>(sumArray.numerators()[COUNT / 2]);
+    });
+
+    std::printf("add (Frac::operator+):        %8.2f M fractions/s\n", before);
+    std::printf("add (FracArray::add, %-6s): %8.2f M fractions/s\n", FracLib::FracArray::kernelName(), after);
+    return 0;
+}
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: format_throughput.cpp
+ * Description:
+ *  Measures fraction formatting throughput in millions of fractions per
+ *  second. The "before" row concatenates `Frac::toString` results the way
+ *  report generation did; the "after" row writes the same values into one
+ *  preallocated buffer with `Frac::toCharsBulk`, which never allocates.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_format_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename FormatFn>
+    double measure(std::size_t count, FormatFn format) {
+        constexpr int ROUNDS = 10;
+        double best = 1e30;
+        std::size_t sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            sink += format();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(count) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 18;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-100000, 100000);
+    std::uniform_int_distribution<int> denominators(1, 100000);
+
+    std::vector<FracLib::Frac> fracs(COUNT);
+    for (FracLib::Frac& f : fracs) {
+        f = FracLib::Frac(numerators(rng), denominators(rng));
+    }
+
+    const double before = measure(COUNT, [&fracs]() {
+        std::string report;
+        for (const FracLib::Frac& f : fracs) {
+            report += FracLib::Frac::toString(f) + "\n";
+        }
+        return report.size();
+    });
+
+    std::vector<char> buffer(COUNT * (FracLib::Frac::MAX_CHARS + 1));
+    const double after = measure(COUNT, [&fracs, &buffer]() {
+        const FracLib::FracWriteResult result = FracLib::Frac::toCharsBulk(buffer.data(), buffer.data() + buffer.size(), fracs.data(), fracs.size());
+        return static_cast<std::size_t>(result.ptr - buffer.data());
+    });
+
+    std::printf("format (toString):    %8.2f M fractions/s\n", before);
+    std::printf("format (toCharsBulk): %8.2f M fractions/s\n", after);
+    return 0;
+}
@@ -0,0 +1,639 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_bench.cpp
+ * Description:
+ *  Google Benchmark suite covering the hot paths of `Frac`: the arithmetic
+ *  operators, simplification, hashing, parsing (`operator>>` and
+ *  `Frac(const char*)`), `toString`, construction from `float` and the
+ *  comparisons.
+ *
+ *  Every operator is measured over three operand distributions:
+ *   - small:    numerators in [-100, 100], denominators in [1, 16]
+ *   - coprime:  coprime denominators in [20000, 46340]
+ *   - overflow: operands whose results sit close to the limits of `int`
+ *  Operand pairs whose result does not fit are discarded while generating,
+ *  so no benchmark measures the exception path.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_bench`, or build
+ *  the `FracLib_bench_json` target to write `FracLib_bench.json` for tracking
+ *  regressions between versions.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac.h"
+#include "frac_accumulator.h"
+#include "frac_array.h"
+#include "frac_big.h"
+#include "frac_fixed.h"
+#include "frac_lazy.h"
+#include "frac_matrix.h"
+#include "frac_memory.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <climits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    using FracLib::Frac;
+    using FracLib::FracError;
+
+    // Operand sets are a power of two so the index wraps with a mask
+    constexpr std::size_t COUNT = 1 << 12;
+    constexpr int NEAR_LIMIT = 1 << 30;
+
+    enum class Dist { Small, Coprime, Overflow };
+    enum class Op { Add, Sub, Mul, Div, Compare };
+
+    struct Operands {
+        std::vector<Frac> lhs;
+        std::vector<Frac> rhs;
+    };
+
+    int gcd(int a, int b) {
+        while (b != 0) {
+            const int t = a % b;
+            a = b;
+            b = t;
+        }
+        return a < 0 ? -a : a;
+    }
+
+    /// @brief Draws one candidate pair for `dist`. The overflow distribution is shaped per
+    /// operator so that enough pairs have a result that still fits.
+    void draw(std::mt19937& rng, Dist dist, Op op, Frac& a, Frac& b) {
+        auto uniform = [&rng](int low, int high) { return std::uniform_int_distribution<int>(low, high)(rng); };
+        switch (dist) {
+            case Dist::Small:
+                a = Frac(uniform(-100, 100), uniform(1, 16), true);
+                b = Frac(uniform(-100, 100), uniform(1, 16), true);
+                return;
+            case Dist::Coprime: {
+                int d1 = 0, d2 = 0;
+                do {
+                    d1 = uniform(20000, 46340);
+                    d2 = uniform(20000, 46340);
+                } while (gcd(d1, d2) != 1);
+                a = Frac(uniform(-d1, d1), d1, true);
+                b = Frac(uniform(-d2, d2), d2, true);
+                return;
+            }
+            case Dist::Overflow:
+                if (op == Op::Add || op == Op::Sub) {
+                    // A shared denominator keeps the sum within range of the large numerators
+                    const int d = uniform(NEAR_LIMIT / 2, NEAR_LIMIT);
+                    a = Frac(uniform(-NEAR_LIMIT, NEAR_LIMIT), d, true);
+                    b = Frac(uniform(-NEAR_LIMIT, NEAR_LIMIT), d, true);
+                } else if (op == Op::Mul || op == Op::Div) {
+                    // Products just below INT_MAX
+                    a = Frac(uniform(32768, 46340), uniform(1, 64), true);
+                    b = Frac(uniform(32768, 46340), uniform(1, 64), true);
+                    if (op == Op::Div) b = Frac(b.denominator, b.numerator);
+                } else {
+                    a = Frac(uniform(-INT_MAX, INT_MAX), uniform(NEAR_LIMIT, INT_MAX));
+                    b = Frac(uniform(-INT_MAX, INT_MAX), uniform(NEAR_LIMIT, INT_MAX));
+                }
+                return;
+        }
+    }
+
+    /// @brief Checks that `op` on `a` and `b` does not overflow.
+    bool fits(Op op, const Frac& a, const Frac& b) {
+        Frac out;
+        switch (op) {
+            case Op::Add: return Frac::tryAdd(a, b, out) == FracError::None;
+            case Op::Sub: return Frac::trySub(a, b, out) == FracError::None;
+            case Op::Mul: return Frac::tryMul(a, b, out) == FracError::None;
+            case Op::Div: return Frac::tryDiv(a, b, out) == FracError::None;
+            default: return true;
+        }
+    }
+
+    Operands makeOperands(Dist dist, Op op) {
+        std::mt19937 rng(2025);
+        Operands operands;
+        operands.lhs.reserve(COUNT);
+        operands.rhs.reserve(COUNT);
+        while (operands.lhs.size() < COUNT) {
+            Frac a, b;
+            draw(rng, dist, op, a, b);
+            if (!fits(op, a, b)) continue;
+            operands.lhs.push_back(a);
+            operands.rhs.push_back(b);
+        }
+        return operands;
+    }
+
+    /// @brief Runs `fn(lhs, rhs)` over the operand set for `dist` and `op`.
+    template <Op op, typename Fn>
+    void runBinary(benchmark::State& state, Dist dist, Fn fn) {
+        const Operands operands = makeOperands(dist, op);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(fn(operands.lhs[i], operands.rhs[i]));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    /// @brief Reduced operands scaled by a random common factor, for the simplification benchmarks.
+    std::vector<Frac> makeUnreduced(Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Compare);
+        std::mt19937 rng(2025);
+        std::vector<Frac> values(COUNT);
+        for (std::size_t i = 0; i < COUNT; i++) {
+            const Frac& f = operands.lhs[i];
+            const int magnitude = std::max(f.numerator < 0 ? -f.numerator : f.numerator, f.denominator);
+            const int factor = std::uniform_int_distribution<int>(1, std::max(1, std::min(1000, INT_MAX / magnitude)))(rng);
+            values[i].numerator = f.numerator * factor;
+            values[i].denominator = f.denominator * factor;
+        }
+        return values;
+    }
+
+    std::vector<std::string> makeStrings(Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Compare);
+        std::vector<std::string> strings;
+        strings.reserve(COUNT);
+        for (const Frac& f : operands.lhs) strings.push_back(Frac::toString(f));
+        return strings;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Arithmetic
+    //\\\\\\\\\\\\\\\\\\\\/
+    void BM_Add(benchmark::State& state, Dist dist) {
+        runBinary<Op::Add>(state, dist, [](const Frac& a, const Frac& b) { return a + b; });
+    }
+    void BM_Sub(benchmark::State& state, Dist dist) {
+        runBinary<Op::Sub>(state, dist, [](const Frac& a, const Frac& b) { return a - b; });
+    }
+    void BM_Mul(benchmark::State& state, Dist dist) {
+        runBinary<Op::Mul>(state, dist, [](const Frac& a, const Frac& b) { return a * b; });
+    }
+    void BM_Div(benchmark::State& state, Dist dist) {
+        runBinary<Op::Div>(state, dist, [](const Frac& a, const Frac& b) { return a / b; });
+    }
+    /// @brief `+` and `*` rounded to denominators of at most 65536 by a `Frac::Context`.
+    void BM_ContextAdd(benchmark::State& state, Dist dist) {
+        Frac::Context context(65536);
+        runBinary<Op::Add>(state, dist, [&context](const Frac& a, const Frac& b) { return context.add(a, b); });
+    }
+    void BM_ContextMul(benchmark::State& state, Dist dist) {
+        Frac::Context context(65536);
+        runBinary<Op::Mul>(state, dist, [&context](const Frac& a, const Frac& b) { return context.mul(a, b); });
+    }
+
+    /// @brief Runs `fn(a, b, c, out)` for `a * b + c`, the addend taken from the next operand pair.
+    /// Uses the `try*` forms since the sum can overflow where the product does not.
+    template <typename Fn>
+    void runMulAdd(benchmark::State& state, Dist dist, Fn fn) {
+        const Operands operands = makeOperands(dist, Op::Mul);
+        std::size_t i = 0;
+        Frac out;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(fn(operands.lhs[i], operands.rhs[i], operands.lhs[(i + 1) & (COUNT - 1)], out));
+            benchmark::DoNotOptimize(out);
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    void BM_MulAdd(benchmark::State& state, Dist dist) {
+        runMulAdd(state, dist, [](const Frac& a, const Frac& b, const Frac& c, Frac& out) {
+            Frac product;
+            const FracError error = Frac::tryMul(a, b, product);
+            return error != FracError::None ? error : Frac::tryAdd(product, c, out);
+        });
+    }
+    void BM_Fma(benchmark::State& state, Dist dist) {
+        runMulAdd(state, dist, [](const Frac& a, const Frac& b, const Frac& c, Frac& out) { return Frac::tryFma(a, b, c, out); });
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Comparisons
+    //\\\\\\\\\\\\\\\\\\\\/
+    void BM_Less(benchmark::State& state, Dist dist) {
+        runBinary<Op::Compare>(state, dist, [](const Frac& a, const Frac& b) { return a < b; });
+    }
+    void BM_Equal(benchmark::State& state, Dist dist) {
+        runBinary<Op::Compare>(state, dist, [](const Frac& a, const Frac& b) { return a == b; });
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Simplification
+    //\\\\\\\\\\\\\\\\\\\\/
+    void BM_Simplify(benchmark::State& state, Dist dist) {
+        const std::vector<Frac> values = makeUnreduced(dist);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            Frac f = values[i];
+            Frac::SimplifyFrac(f);
+            benchmark::DoNotOptimize(f);
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+
+    void BM_Hash(benchmark::State& state, Dist dist) {
+        const std::vector<Frac> values = makeUnreduced(dist);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(std::hash<Frac>{}(values[i]));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Parsing & Formatting
+    //\\\\\\\\\\\\\\\\\\\\/
+    void BM_ParseCString(benchmark::State& state, Dist dist) {
+        const std::vector<std::string> strings = makeStrings(dist);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Frac(strings[i].c_str()));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    void BM_ParseStream(benchmark::State& state, Dist dist) {
+        const std::vector<std::string> strings = makeStrings(dist);
+        std::string text;
+        for (const std::string& s : strings) text += s + '\n';
+        std::istringstream stream(text);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            Frac f;
+            stream >> f;
+            benchmark::DoNotOptimize(f);
+            if (++i == COUNT) {
+                // Rewind outside the measured region
+                state.PauseTiming();
+                stream.clear();
+                stream.seekg(0);
+                i = 0;
+                state.ResumeTiming();
+            }
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    void BM_ToString(benchmark::State& state, Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Compare);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Frac::toString(operands.lhs[i]));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    void BM_FromFloat(benchmark::State& state, Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Compare);
+        std::vector<float> values(COUNT);
+        for (std::size_t i = 0; i < COUNT; i++) {
+            values[i] = static_cast<float>(operands.lhs[i].numerator) / static_cast<float>(operands.lhs[i].denominator);
+        }
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Frac(values[i]));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+
+    /// @brief Runs `fn(x)` for `x * 3/4 + 1/8`, with the constants written as `fn` chooses.
+    template <typename Fn>
+    void runConstants(benchmark::State& state, Dist dist, Fn fn) {
+        const Operands operands = makeOperands(dist, Op::Mul);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(fn(operands.lhs[i]));
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    void BM_ConstantConverted(benchmark::State& state, Dist dist) {
+        runConstants(state, dist, [](const Frac& x) { return x * Frac("3/4") + Frac(0.125f); });
+    }
+    void BM_ConstantLiteral(benchmark::State& state, Dist dist) {
+        using namespace FracLib::literals;
+        runConstants(state, dist, [](const Frac& x) { return x * "3/4"_frac + 0.125_frac; });
+    }
+    /// @brief `x * 12 5/8 + 1.75` through the mixed `const char*` and `float` operators, with the
+    /// conversion cache of this thread off or on.
+    void BM_MixedOperands(benchmark::State& state, Dist dist) {
+        runConstants(state, dist, [](const Frac& x) { return x * "12 5/8" + 1.75f; });
+    }
+    void BM_MixedOperandsCached(benchmark::State& state, Dist dist) {
+        FracLib::setThreadConversionCache(FracLib::FracCacheMode::Enabled);
+        runConstants(state, dist, [](const Frac& x) { return x * "12 5/8" + 1.75f; });
+        FracLib::setThreadConversionCache(FracLib::FracCacheMode::Inherit);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Fixed Denominator
+    //\\\\\\\\\\\\\\\\\\\\/
+    using Cents = FracLib::FixedFrac<100>;
+
+    /// @brief Prices in cents below 1000000.00, as fractions with denominator 100 and as `Cents`.
+    void makePrices(std::vector<Frac>& fracs, std::vector<Cents>& cents) {
+        std::mt19937 rng(2025);
+        std::uniform_int_distribution<int> uniform(-100000000, 100000000);
+        fracs.resize(COUNT);
+        cents.resize(COUNT);
+        for (std::size_t i = 0; i < COUNT; i++) {
+            cents[i] = Cents::fromTicks(uniform(rng));
+            fracs[i] = Frac(cents[i].ticks(), 100, true);
+        }
+    }
+
+    void BM_PriceAddFrac(benchmark::State& state) {
+        std::vector<Frac> fracs;
+        std::vector<Cents> cents;
+        makePrices(fracs, cents);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(fracs[i] + fracs[(i + 1) & (COUNT - 1)]);
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    void BM_PriceAddFixed(benchmark::State& state) {
+        std::vector<Frac> fracs;
+        std::vector<Cents> cents;
+        makePrices(fracs, cents);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(cents[i] + cents[(i + 1) & (COUNT - 1)]);
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    /// @brief `FracArray::add` over the prices, including the reduction of the `Frac` path.
+    void BM_PriceAddArray(benchmark::State& state) {
+        std::vector<Frac> fracs;
+        std::vector<Cents> cents;
+        makePrices(fracs, cents);
+        const FracLib::FracArray a(fracs.data(), COUNT);
+        FracLib::FracArray out;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(FracLib::FracArray::add(a, a, out));
+            benchmark::DoNotOptimize(out.numerators());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * COUNT));
+    }
+    void BM_PriceAddFixedBatch(benchmark::State& state) {
+        std::vector<Frac> fracs;
+        std::vector<Cents> cents;
+        makePrices(fracs, cents);
+        std::vector<Cents> out(COUNT);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Cents::add(cents.data(), cents.data(), out.data(), COUNT));
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * COUNT));
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Filtering
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief Tests every element against `3/7`: one `Frac::operator>=` per element into a `std::vector<bool>`,
+    /// then `FracArray::compare` into a `FracMask` and `FracArray::countIf`.
+    void BM_FilterScalar(benchmark::State& state, Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Compare);
+        const Frac threshold(3, 7);
+        std::vector<bool> mask(COUNT);
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < COUNT; i++) mask[i] = operands.lhs[i] >= threshold;
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * COUNT));
+    }
+    void BM_FilterCompare(benchmark::State& state, Dist dist) {
+        const FracLib::FracArray a(makeOperands(dist, Op::Compare).lhs.data(), COUNT);
+        FracLib::FracMask mask;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(FracLib::FracArray::compare(a, FracLib::FracCompare::GreaterEqual, Frac(3, 7), mask));
+            benchmark::DoNotOptimize(mask.words());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * COUNT));
+    }
+    void BM_FilterCountIf(benchmark::State& state, Dist dist) {
+        const FracLib::FracArray a(makeOperands(dist, Op::Compare).lhs.data(), COUNT);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(FracLib::FracArray::countIf(a, FracLib::FracCompare::GreaterEqual, Frac(3, 7)));
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * COUNT));
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Lazy Normalization
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief Evaluates `(a * b + a) - b` and hashes it, so the result is needed in canonical form once.
+    template <typename FracT>
+    void runExpression(benchmark::State& state, Dist dist) {
+        const Operands operands = makeOperands(dist, Op::Mul);
+        std::size_t i = 0;
+        for (auto _ : state) {
+            const FracT a(operands.lhs[i]), b(operands.rhs[i]);
+            benchmark::DoNotOptimize(((a * b + a) - b).hash());
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    void BM_Expression(benchmark::State& state, Dist dist) {
+        runExpression<Frac>(state, dist);
+    }
+    void BM_LazyExpression(benchmark::State& state, Dist dist) {
+        runExpression<FracLib::LazyFrac>(state, dist);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Arbitrary Precision
+    //\\\\\\\\\\\\\\\\\\\\/
+    void BM_BigExpression(benchmark::State& state, Dist dist) {
+        runExpression<FracLib::BigFrac>(state, dist);
+    }
+
+    /// @brief Sums `1/1 + ... + 1/n`, whose denominator outgrows 128 bits after about 100 terms.
+    void BM_BigHarmonic(benchmark::State& state) {
+        const int terms = static_cast<int>(state.range(0));
+        for (auto _ : state) {
+            FracLib::BigFrac sum;
+            for (int k = 1; k <= terms; k++) sum += FracLib::BigFrac(1, k);
+            benchmark::DoNotOptimize(sum.hash());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * terms);
+    }
+
+    /// @brief `BM_BigHarmonic` with the limbs in a `FracArena` that is reset after every sum.
+    void BM_BigHarmonicArena(benchmark::State& state) {
+        const int terms = static_cast<int>(state.range(0));
+        FracLib::FracArena arena;
+        for (auto _ : state) {
+            {
+                FracLib::BigFrac sum(&arena);
+                for (int k = 1; k <= terms; k++) sum += FracLib::BigFrac(1, k);
+                benchmark::DoNotOptimize(sum.hash());
+            }
+            arena.reset();
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * terms);
+    }
+
+    /// @brief Every benchmark thread adds small operands into one total: a `BigFrac` behind a mutex,
+    /// then a `FracAccumulator`, which is read once at the end.
+    std::mutex sharedSumMutex;
+    FracLib::BigFrac sharedSum;
+    FracLib::FracAccumulator sharedAccumulator;
+
+    void BM_SharedSumMutex(benchmark::State& state) {
+        const Operands operands = makeOperands(Dist::Small, Op::Add);
+        if (state.thread_index() == 0) sharedSum = FracLib::BigFrac();
+        std::size_t i = 0;
+        for (auto _ : state) {
+            const std::lock_guard<std::mutex> lock(sharedSumMutex);
+            sharedSum += FracLib::BigFrac(operands.lhs[i]);
+            i = (i + 1) & (COUNT - 1);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    void BM_SharedSumAccumulator(benchmark::State& state) {
+        const Operands operands = makeOperands(Dist::Small, Op::Add);
+        if (state.thread_index() == 0) sharedAccumulator.reset();
+        std::size_t i = 0;
+        for (auto _ : state) {
+            sharedAccumulator += operands.lhs[i];
+            i = (i + 1) & (COUNT - 1);
+        }
+        if (state.thread_index() == 0) benchmark::DoNotOptimize(sharedAccumulator.snapshot().hash());
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Linear Algebra
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief `n` x `n` system with small random fractions, the shape hand-written elimination struggles with.
+    void makeSystem(std::size_t n, FracLib::FracMatrix& a, FracLib::FracMatrix& b) {
+        std::mt19937 rng(2025);
+        std::uniform_int_distribution<int> numerators(-9, 9);
+        std::uniform_int_distribution<int> denominators(1, 9);
+        a = FracLib::FracMatrix(n, n);
+        b = FracLib::FracMatrix(n, 1);
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t j = 0; j < n; j++) a(i, j) = FracLib::Frac(numerators(rng), denominators(rng));
+            b(i, 0) = FracLib::Frac(numerators(rng), denominators(rng));
+        }
+    }
+
+    /// @brief Textbook Gaussian elimination and back substitution with `BigFrac`, reducing after every step.
+    void BM_GaussBigFrac(benchmark::State& state) {
+        const std::size_t n = static_cast<std::size_t>(state.range(0));
+        FracLib::FracMatrix a, b;
+        makeSystem(n, a, b);
+        for (auto _ : state) {
+            std::vector<FracLib::BigFrac> m;
+            for (std::size_t i = 0; i < n; i++) {
+                for (std::size_t j = 0; j < n; j++) m.emplace_back(a(i, j));
+                m.emplace_back(b(i, 0));
+            }
+            const std::size_t cols = n + 1;
+            for (std::size_t k = 0; k < n; k++) {
+                std::size_t p = k;
+                while (m[p * cols + k] == FracLib::BigFrac(0)) p++;
+                for (std::size_t j = 0; j < cols; j++) std::swap(m[p * cols + j], m[k * cols + j]);
+                for (std::size_t i = k + 1; i < n; i++) {
+                    const FracLib::BigFrac factor = m[i * cols + k] / m[k * cols + k];
+                    for (std::size_t j = k; j < cols; j++) m[i * cols + j] -= factor * m[k * cols + j];
+                }
+            }
+            std::vector<FracLib::BigFrac> x(n);
+            for (std::size_t i = n; i-- > 0;) {
+                FracLib::BigFrac value = m[i * cols + n];
+                for (std::size_t j = i + 1; j < n; j++) value -= m[i * cols + j] * x[j];
+                x[i] = value / m[i * cols + i];
+            }
+            benchmark::DoNotOptimize(x[0].hash());
+        }
+    }
+
+    /// @brief The same system with `FracLib::solve` (fraction-free Bareiss) on one thread.
+    void BM_BareissSolve(benchmark::State& state) {
+        const std::size_t n = static_cast<std::size_t>(state.range(0));
+        FracLib::FracMatrix a, b, x;
+        makeSystem(n, a, b);
+        for (auto _ : state) {
+            // The solution of a random system rarely fits in `Frac`, which is still a complete solve
+            benchmark::DoNotOptimize(FracLib::trySolve(a, b, x, 1));
+        }
+    }
+}
+
+#define FRACLIB_BENCH(fn) \
+    BENCHMARK_CAPTURE(fn, small, Dist::Small); \
+    BENCHMARK_CAPTURE(fn, coprime, Dist::Coprime); \
+    BENCHMARK_CAPTURE(fn, overflow, Dist::Overflow)
+
+FRACLIB_BENCH(BM_Add);
+FRACLIB_BENCH(BM_Sub);
+FRACLIB_BENCH(BM_Mul);
+FRACLIB_BENCH(BM_Div);
+FRACLIB_BENCH(BM_ContextAdd);
+FRACLIB_BENCH(BM_ContextMul);
+FRACLIB_BENCH(BM_MulAdd);
+FRACLIB_BENCH(BM_Fma);
+FRACLIB_BENCH(BM_Less);
+FRACLIB_BENCH(BM_Equal);
+FRACLIB_BENCH(BM_Simplify);
+FRACLIB_BENCH(BM_Hash);
+FRACLIB_BENCH(BM_ParseCString);
+FRACLIB_BENCH(BM_ParseStream);
+FRACLIB_BENCH(BM_ToString);
+FRACLIB_BENCH(BM_FromFloat);
+FRACLIB_BENCH(BM_FilterScalar);
+FRACLIB_BENCH(BM_FilterCompare);
+FRACLIB_BENCH(BM_FilterCountIf);
+// Intermediate results of the other distributions can overflow
+BENCHMARK_CAPTURE(BM_ConstantConverted, small, Dist::Small);
+BENCHMARK_CAPTURE(BM_ConstantLiteral, small, Dist::Small);
+BENCHMARK_CAPTURE(BM_MixedOperands, small, Dist::Small);
+BENCHMARK_CAPTURE(BM_MixedOperandsCached, small, Dist::Small);
+BENCHMARK_CAPTURE(BM_Expression, small, Dist::Small);
+BENCHMARK_CAPTURE(BM_LazyExpression, small, Dist::Small);
+FRACLIB_BENCH(BM_BigExpression);
+BENCHMARK(BM_BigHarmonic)->Arg(32)->Arg(256);
+BENCHMARK(BM_BigHarmonicArena)->Arg(32)->Arg(256);
+BENCHMARK(BM_SharedSumMutex)->Threads(1)->Threads(4);
+BENCHMARK(BM_SharedSumAccumulator)->Threads(1)->Threads(4);
+BENCHMARK(BM_PriceAddFrac);
+BENCHMARK(BM_PriceAddFixed);
+BENCHMARK(BM_PriceAddArray);
+BENCHMARK(BM_PriceAddFixedBatch);
+BENCHMARK(BM_GaussBigFrac)->Arg(8)->Arg(32);
+BENCHMARK(BM_BareissSolve)->Arg(8)->Arg(32);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: ingest_throughput.cpp
+ * Description:
+ *  Measures loading text with one fraction per line: a `std::istream` loop
+ *  with `operator>>` versus `FracLib::ingest` on one thread and on every
+ *  hardware thread.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_ingest_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_ingest.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    template <typename LoadFn>
+    double measure(const std::string& text, LoadFn load) {
+        constexpr int ROUNDS = 5;
+        double best = 1e30;
+        std::size_t sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            sink += load(text);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(text.size()) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr int COUNT = 1 << 20;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-100000, 100000);
+    std::uniform_int_distribution<int> denominators(1, 100000);
+
+    std::string text;
+    for (int i = 0; i < COUNT; i++) {
+        text += std::to_string(numerators(rng)) + "/" + std::to_string(denominators(rng)) + "\n";
+    }
+
+    const double stream = measure(text, [](const std::string& input) {
+        std::istringstream is(input);
+        FracLib::FracArray values;
+        FracLib::Frac f;
+        // `operator>>` reads a whole line, and throws on the empty one after the last newline
+        while (is.peek() != std::char_traits<char>::eof() && is >> f) values.push_back(f);
+        return values.size();
+    });
+    const double serial = measure(text, [](const std::string& input) {
+        FracLib::FracArray values;
+        FracLib::ingest(input, values, nullptr, 1);
+        return values.size();
+    });
+    const double parallel = measure(text, [](const std::string& input) {
+        FracLib::FracArray values;
+        FracLib::ingest(input, values);
+        return values.size();
+    });
+
+    std::printf("load (operator>>):            %8.1f MB/s\n", stream);
+    std::printf("load (ingest, 1 thread):      %8.1f MB/s\n", serial);
+    std::printf("load (ingest, %2u threads):    %8.1f MB/s\n", std::thread::hardware_concurrency(), parallel);
+    return 0;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: load_throughput.cpp
+ * Description:
+ *  Measures loading a saved array of fractions: parsing text written with
+ *  `operator<<` through `Frac::fromChars`, reading the binary format with
+ *  `readBinary`, and mapping it with `MappedFracArray` followed by one pass
+ *  over the view.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_load_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_binary.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
+namespace {
+    template <typename LoadFn>
+    double measure(std::size_t count, LoadFn load) {
+        constexpr int ROUNDS = 5;
+        double best = 1e30;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            load();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        return static_cast<double>(count) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 22;
+    const char* TEXT_PATH = "FracLib_load_throughput.txt";
+    const char* BINARY_PATH = "FracLib_load_throughput.frac";
+
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-1000000, 1000000);
+    std::uniform_int_distribution<int> denominators(1, 1000000);
+    FracLib::FracArray source;
+    source.reserve(COUNT);
+    for (std::size_t i = 0; i < COUNT; i++) source.push_back(FracLib::Frac(numerators(rng), denominators(rng)));
+
+    {
+        std::ofstream text(TEXT_PATH);
+        for (std::size_t i = 0; i < source.size(); i++) text << source.get(i) << '\n';
+        std::ofstream binary(BINARY_PATH, std::ios::binary);
+        FracLib::writeBinary(binary, source);
+    }
+
+    long long checksum = 0;
+    FracLib::FracArray values;
+    const double text = measure(COUNT, [&]() {
+        std::ifstream file(TEXT_PATH);
+        const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        values.clear();
+        const char* first = contents.data();
+        const char* last = first + contents.size();
+        FracLib::Frac value;
+        while (first < last) {
+            first = FracLib::Frac::fromChars(first, last, value).ptr + 1;
+            values.push_back(value);
+        }
+    });
+    const double binary = measure(COUNT, [&]() {
+        std::ifstream file(BINARY_PATH, std::ios::binary);
+        FracLib::readBinary(file, values);
+    });
+    const double mapped = measure(COUNT, [&]() {
+        FracLib::MappedFracArray mapping;
+        FracLib::MappedFracArray::open(BINARY_PATH, mapping);
+        const FracLib::FracArrayView view = mapping.view();
+        for (std::size_t i = 0; i < view.size(); i++) checksum += view.numerators()[i] ^ view.denominators()[i];
+    });
+
+    std::remove(TEXT_PATH);
+    std::remove(BINARY_PATH);
+    std::printf("%zu fractions (checksum %lld)\n", COUNT, checksum);
+    std::printf("  text (fromChars):        %8.2f M fractions/s\n", text);
+    std::printf("  readBinary (FracArray):  %8.2f M fractions/s\n", binary);
+    std::printf("  MappedFracArray + scan:  %8.2f M fractions/s\n", mapped);
+    return 0;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: parse_throughput.cpp
+ * Description:
+ *  Measures fraction parsing throughput in MB/s. The "before" row parses each
+ *  field through a `std::istringstream` the way `Frac(const char*)` used to;
+ *  the "after" row walks one contiguous buffer with `Frac::fromChars`, which
+ *  neither allocates nor touches iostreams.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_parse_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    // The stream-based path FracLib used before `fromChars`.
+    bool legacyParse(const std::string& field, FracLib::Frac& out) {
+        std::istringstream iss(field);
+        int numerator = 0, denominator = 0;
+        char slash = 0;
+        if (!(iss >> numerator >> slash >> denominator) || slash != '/' || denominator == 0) return false;
+        out = FracLib::Frac(numerator, denominator);
+        return true;
+    }
+
+    template <typename ParseFn>
+    double measure(const std::string& text, ParseFn parse) {
+        constexpr int ROUNDS = 10;
+        double best = 1e30;
+        long long sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            sink += parse(text);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(text.size()) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr int COUNT = 1 << 18;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-100000, 100000);
+    std::uniform_int_distribution<int> denominators(1, 100000);
+
+    std::string text;
+    for (int i = 0; i < COUNT; i++) {
+        text += std::to_string(numerators(rng)) + "/" + std::to_string(denominators(rng)) + "\n";
+    }
+
+    const double before = measure(text, [](const std::string& input) {
+        long long sum = 0;
+        std::size_t start = 0;
+        FracLib::Frac f;
+        while (start < input.size()) {
+            const std::size_t end = input.find('\n', start);
+            if (legacyParse(input.substr(start, end - start), f)) sum += f.numerator;
+            start = end + 1;
+        }
+        return sum;
+    });
+
+    const double after = measure(text, [](const std::string& input) {
+        long long sum = 0;
+        const char* p = input.data();
+        const char* last = p + input.size();
+        FracLib::Frac f;
+        while (p < last) {
+            const FracLib::FracParseResult result = FracLib::Frac::fromChars(p, last, f);
+            if (result.error == FracLib::FracError::None) sum += f.numerator;
+            p = result.ptr + 1; // skip the newline
+        }
+        return sum;
+    });
+
+    std::printf("parse (istringstream):   %8.1f MB/s\n", before);
+    std::printf("parse (Frac::fromChars): %8.1f MB/s\n", after);
+    return 0;
+}
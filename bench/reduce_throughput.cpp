@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: reduce_throughput.cpp
+ * Description:
+ *  Measures the exact sum of a large range of fractions: a serial
+ *  `Frac128::operator+=` loop versus `FracLib::reduceSum` on one thread and
+ *  on every hardware thread. Denominators are drawn from the small set
+ *  typical of prices and measurements so the exact sum stays representable.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_reduce_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_reduce.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+    template <typename SumFn>
+    double measure(std::size_t count, SumFn sum) {
+        constexpr int ROUNDS = 5;
+        double best = 1e30;
+        long long sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            const auto start = std::chrono::steady_clock::now();
+            sink += static_cast<long long>(sum().denominator);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(count) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 22;
+    constexpr int DENOMINATORS[] = {2, 3, 4, 5, 8, 10, 12, 16, 25, 100, 360, 1000};
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-100000, 100000);
+    std::uniform_int_distribution<std::size_t> denominators(0, sizeof(DENOMINATORS) / sizeof(DENOMINATORS[0]) - 1);
+
+    std::vector<FracLib::Frac> values(COUNT);
+    for (FracLib::Frac& f : values) {
+        f.numerator = numerators(rng);
+        f.denominator = DENOMINATORS[denominators(rng)];
+    }
+
+    const double before = measure(COUNT, [&values]() {
+        FracLib::Frac128 total(0);
+        for (const FracLib::Frac& f : values) total += FracLib::Frac128(f);
+        return total;
+    });
+    const double single = measure(COUNT, [&values]() { return FracLib::reduceSum(values.begin(), values.end(), 1); });
+    const double parallel = measure(COUNT, [&values]() { return FracLib::reduceSum(values.begin(), values.end()); });
+
+    std::printf("sum (Frac128 += loop):            %8.2f M fractions/s\n", before);
+    std::printf("sum (reduceSum, 1 thread):        %8.2f M fractions/s\n", single);
+    std::printf("sum (reduceSum, %3u threads):     %8.2f M fractions/s\n", std::thread::hardware_concurrency(), parallel);
+    return 0;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: simplify_throughput.cpp
+ * Description:
+ *  Measures normalization of unreduced fractions, as produced by batch
+ *  arithmetic: a loop of `Frac::SimplifyFrac` versus `Frac::SimplifyBatch`
+ *  and `FracArray::simplifyAll`. The kernel name printed shows which
+ *  instruction set was selected for this CPU.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_simplify_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_array.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename PrepareFn, typename SimplifyFn>
+    double measure(std::size_t count, PrepareFn prepare, SimplifyFn simplify) {
+        constexpr int ROUNDS = 20;
+        double best = 1e30;
+        long long sink = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            prepare();
+            const auto start = std::chrono::steady_clock::now();
+            sink += simplify();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        // Keep the results observable so the loop is not optimized away
+        if (sink == 42) std::puts("");
+        return static_cast<double>(count) / best / 1e6;
+    }
+}
+
+int main() {
+    constexpr std::size_t COUNT = 1 << 18;
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> numerators(-1000, 1000);
+    std::uniform_int_distribution<int> denominators(1, 1000);
+
+    // Unreduced sums a/b + c/d = (ad + cb)/bd
+    std::vector<FracLib::Frac> source(COUNT), values(COUNT);
+    for (FracLib::Frac& f : source) {
+        const int a = numerators(rng), b = denominators(rng), c = numerators(rng), d = denominators(rng);
+        f.numerator = a * d + c * b;
+        f.denominator = b * d;
+    }
+    FracLib::FracArray array;
+    const auto reset = [&source, &values]() { values = source; };
+
+    const double before = measure(COUNT, reset, [&]() {
+        for (FracLib::Frac& f : values) FracLib::Frac::SimplifyFrac(f);
+        return static_cast<long long>(values[COUNT / 2].denominator);
+    });
+    const double batch = measure(COUNT, reset, [&]() {
+        FracLib::Frac::SimplifyBatch(values.data(), values.size());
+        return static_cast<long long>(values[COUNT / 2].denominator);
+    });
+    const double soa = measure(COUNT, [&]() { array = FracLib::FracArray(source.data(), source.size()); }, [&]() {
+        FracLib::FracArray::simplifyAll(array);
+        return static_cast<long long>(array.denominators()[COUNT / 2]);
+    });
+
+    const char* kernel = FracLib::FracArray::kernelName();
+    std::printf("simplify (SimplifyFrac loop):              %8.2f M fractions/s\n", before);
+    std::printf("simplify (SimplifyBatch, %-6s):           %8.2f M fractions/s\n", kernel, batch);
+    std::printf("simplify (FracArray::simplifyAll, %-6s): %8.2f M fractions/s\n", kernel, soa);
+    return 0;
+}
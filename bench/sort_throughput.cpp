@@ -0,0 +1,75 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: sort_throughput.cpp
+ * Description:
+ *  Measures sorting an array of fractions: `std::sort` with `Frac::operator<`
+ *  versus the exact-key radix sort `FracLib::sort`, for `Frac` arrays and
+ *  for `FracArray`, with small and with large denominators.
+ *
+ *  Build with -DFRACLIB_BUILD_BENCHMARKS=ON and run `FracLib_sort_throughput`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "frac_sort.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename ResetFn, typename SortFn>
+    double measure(std::size_t count, ResetFn reset, SortFn sort) {
+        constexpr int ROUNDS = 5;
+        double best = 1e30;
+        for (int round = 0; round < ROUNDS; round++) {
+            reset();
+            const auto start = std::chrono::steady_clock::now();
+            sort();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        return static_cast<double>(count) / best / 1e6;
+    }
+
+    void run(const char* name, int maxNumerator, int maxDenominator) {
+        constexpr std::size_t COUNT = 1 << 22;
+        std::mt19937 rng(2025);
+        std::uniform_int_distribution<int> numerators(-maxNumerator, maxNumerator);
+        std::uniform_int_distribution<int> denominators(1, maxDenominator);
+
+        std::vector<FracLib::Frac> source(COUNT), values;
+        for (FracLib::Frac& f : source) f = FracLib::Frac(numerators(rng), denominators(rng));
+        FracLib::FracArray array;
+
+        const double before = measure(COUNT, [&]() { values = source; }, [&]() {
+            std::sort(values.begin(), values.end());
+        });
+        const double after = measure(COUNT, [&]() { values = source; }, [&]() {
+            FracLib::sort(values.data(), values.data() + values.size());
+        });
+        const double soa = measure(COUNT, [&]() { array = FracLib::FracArray(source.data(), source.size()); }, [&]() {
+            FracLib::sort(array);
+        });
+
+        std::printf("%s\n", name);
+        std::printf("  std::sort (operator<):     %8.2f M fractions/s\n", before);
+        std::printf("  FracLib::sort (Frac*):     %8.2f M fractions/s\n", after);
+        std::printf("  FracLib::sort (FracArray): %8.2f M fractions/s\n", soa);
+    }
+}
+
+int main() {
+    run("denominators in [1, 16]", 100, 16);
+    run("denominators in [1, 1000000]", 1000000, 1000000);
+    return 0;
+}
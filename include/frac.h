@@ -2,9 +2,10 @@
  * Project: FracLib
  * File: Frac.h
  * Description:
- *  This header file defines the Frac class within the FracLib namespace, 
- *  which provides functionality for handling and performing operations on fractions. 
- *  The Frac class includes constructors for initializing fractions, 
+ *  This header file defines the BasicFrac class template within the FracLib
+ *  namespace, which provides functionality for handling and performing operations
+ *  on fractions. `Frac` is `BasicFrac<int>`; `Frac64` and `Frac128` store 64-bit
+ *  and 128-bit numerators and denominators. The class includes constructors for initializing fractions, 
  *  operators for arithmetic and comparison, as well as methods for 
  *  simplifying fractions, converting to and from different representations, 
  *  and performing utility tasks such as parsing strings and handling decimals.
@@ -25,198 +26,480 @@
  *****************************************************************************/
 
 #pragma once
-#include <stdexcept>
+#include "frac_traits.h"
+#include "frac_error.h"
+#include "frac_stats.h"
+#include "frac_cache.h"
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <type_traits>
+
+#if defined(__cpp_impl_three_way_comparison) && __has_include(<compare>)
+    #include <compare>
+    #define FRACLIB_HAS_THREE_WAY_COMPARISON 1
+#endif
+
+// Define FRACLIB_HEADER_ONLY (or link FracLib::FracHeaderOnly) to use the library
+// without the static archive. Every definition is then pulled into this header.
+#ifdef FRACLIB_HEADER_ONLY
+    #define FRACLIB_INLINE inline
+#else
+    #define FRACLIB_INLINE
+#endif
 
 namespace FracLib {
-    class Frac {
+    template <typename IntT> class BasicFracContext;
+
+    /// @brief Fraction with numerator and denominator stored as `IntT`.
+    /// Supported storage types are 32-bit, 64-bit and (where available) 128-bit signed integers.
+    /// Arithmetic computes intermediate products in the next wider integer type and only throws
+    /// if the result still does not fit in `IntT` after reduction. Every throwing operation has a
+    /// non-throwing `try*` counterpart returning a `FracError`.
+    /// @tparam IntT signed integer storage type.
+    template <typename IntT>
+    class BasicFrac {
+        static_assert(detail::IsFracInt<IntT>::value, "BasicFrac requires a 32, 64 or 128-bit signed integer type.");
+
+    public: // TYPES
+        using value_type = IntT;
+        /// @brief Arithmetic that rounds every result to a bounded denominator (see frac_context.h).
+        using Context = BasicFracContext<IntT>;
+
     public: // ERROR STRINGS
-        static const char* ZERO_DIVISOR_ERROR;
-        static const char* OVERFLOW_ERROR;
-        static const char* INVALID_STRING_PARAMETER_ERROR;
+        static constexpr const char* ZERO_DIVISOR_ERROR = detail::ZERO_DIVISOR_MESSAGE;
+        static constexpr const char* OVERFLOW_ERROR = detail::OVERFLOW_MESSAGE;
+        static constexpr const char* INVALID_STRING_PARAMETER_ERROR = detail::INVALID_STRING_PARAMETER_MESSAGE;
+        /// @brief Buffer size that fits any fraction written by `toChars`, in either format.
+        static constexpr std::size_t MAX_CHARS = 3 * detail::IntTraits<IntT>::decimalDigits + 3;
     public: // ATTRIBUTES
-        int numerator;
-        int denominator;
+        IntT numerator;
+        IntT denominator;
 
     public: // CONSTRUCTORS
         /// @brief Default constructor. Initializes the fraction to `0/1`.
         /// @example Frac f; // Represents 0/1
-        Frac();
+        constexpr BasicFrac() noexcept;
         /// @brief Constructs a Frac object with the given integer numerator.
         /// @param n The integer numerator (denominator is set to 1).
+        /// @throws std::overflow_error if `n` does not fit in `IntT`.
         /// @example Frac f(5); // Creates a fraction representing 5/1
-        Frac(int n);
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        constexpr BasicFrac(T n);
         /// @brief Constructs a Frac object with the specified numerator and denominator.
         /// @param n The numerator.
         /// @param d The denominator.
         /// @param isSimplifying Determines whether the fraction will attempt to simplify or not.
         /// @throws std::invalid_argument If the denominator is zero.
         /// @example Frac f(3, 4); // Creates a fraction representing 3/4
-        Frac(int n, int d, bool isSimplifying = false);
-        /// @brief Constructs a Frac object from a decimal number by approximating its fractional equivalent.
-        /// The fraction is then simplified automatically.
+        constexpr BasicFrac(IntT n, IntT d, bool isSimplifying = false);
+        /// @brief Constructs a Frac object holding the exact value of a decimal number.
+        /// The result is in lowest terms. If the exact value does not fit in `IntT`, the closest
+        /// fraction that does is used instead (see `fromDouble`).
         /// @param decimal The decimal number to convert to a fraction.
+        /// @throws std::overflow_error if the magnitude does not fit in `IntT`.
+        /// @throws std::invalid_argument if the decimal is infinite or NaN.
         /// @example Frac f(0.75); // Creates a fraction representing 3/4
-        Frac(float decimal);
+        BasicFrac(float decimal);
         /// @brief Constructs a Frac object by parsing a c-string representation.
+        /// `constexpr`, so a constant string is parsed at compile time when the result initializes a
+        /// `constexpr` variable (see also the `_frac` literal).
         /// @param fracStr The c-string representing the fraction, in the format "numerator/denominator", "numerator" or "whole numerator/denominator".
         /// @param isSimplifying Determines whether the fraction will simplify or not.
         /// @throws std::invalid_argument if the string is not properly formatted or if the denominator is zero.
         /// @example Frac f("3/4"); // Creates a fraction representing 3/4
-        Frac(const char* fracStr, bool isSimplifying = false);
+        constexpr BasicFrac(const char* fracStr, bool isSimplifying = false);
         /// @brief Copy constructor. Creates a new Frac object as a copy of an existing Frac.
+        /// Copies and moves are trivial, so arrays of fractions can be copied with `memcpy`.
         /// @param other The Frac object to copy.
-        Frac(Frac& other);
+        constexpr BasicFrac(const BasicFrac& other) noexcept = default;
+        constexpr BasicFrac(BasicFrac&& other) noexcept = default;
+        /// @brief Converts a fraction of another storage width to this one.
+        /// @param other fraction to convert.
+        /// @throws std::overflow_error if the reduced value does not fit in `IntT`.
+        /// @example Frac64 wide(Frac(1, 3)); // 1/3 stored in 64 bits
+        template <typename OtherIntT, typename = std::enable_if_t<!std::is_same<OtherIntT, IntT>::value>>
+        explicit constexpr BasicFrac(const BasicFrac<OtherIntT>& other);
 
     public: // OPERATORS
         
         // Basic Arithmetic
-        Frac operator+(const Frac& other);
-        Frac operator+(int value);
-        Frac operator+(float value);
-        Frac operator+(const char* value);
-
-        Frac operator-(const Frac& other);
-        Frac operator-(int value);
-        Frac operator-(float value);
-        Frac operator-(const char* value);
-
-        Frac operator*(const Frac& other);
-        Frac operator*(int value);
-        Frac operator*(float value);
-        Frac operator*(const char* value);
-
-        Frac operator/(const Frac& other);
-        Frac operator/(int value);
-        Frac operator/(float value);
-        Frac operator/(const char* value);
+        constexpr BasicFrac operator+(const BasicFrac& other) const;
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac operator+(T value) const;
+        BasicFrac operator+(float value) const;
+        BasicFrac operator+(const char* value) const;
+
+        constexpr BasicFrac operator-(const BasicFrac& other) const;
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac operator-(T value) const;
+        BasicFrac operator-(float value) const;
+        BasicFrac operator-(const char* value) const;
+
+        constexpr BasicFrac operator*(const BasicFrac& other) const;
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac operator*(T value) const;
+        BasicFrac operator*(float value) const;
+        BasicFrac operator*(const char* value) const;
+
+        constexpr BasicFrac operator/(const BasicFrac& other) const;
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac operator/(T value) const;
+        BasicFrac operator/(float value) const;
+        BasicFrac operator/(const char* value) const;
         
         // Reversed operand order
-        friend Frac operator+(int value, const Frac& frac);
-        friend Frac operator+(float value, Frac& frac);
-        friend Frac operator+(const char* value, Frac& frac);
+        template <typename T, typename = detail::EnableIfInteger<T>> friend constexpr BasicFrac operator+(T value, const BasicFrac& frac) { return BasicFrac(value) + frac; }
+        friend BasicFrac operator+(float value, const BasicFrac& frac) { return fromOperand(value) + frac; }
+        friend BasicFrac operator+(const char* value, const BasicFrac& frac) { return fromOperand(value) + frac; }
 
-        friend Frac operator-(int value, const Frac& frac);
-        friend Frac operator-(float value, Frac& frac);
-        friend Frac operator-(const char* value, Frac& frac);
+        template <typename T, typename = detail::EnableIfInteger<T>> friend constexpr BasicFrac operator-(T value, const BasicFrac& frac) { return BasicFrac(value) - frac; }
+        friend BasicFrac operator-(float value, const BasicFrac& frac) { return fromOperand(value) - frac; }
+        friend BasicFrac operator-(const char* value, const BasicFrac& frac) { return fromOperand(value) - frac; }
 
-        friend Frac operator*(int value, const Frac& frac);
-        friend Frac operator*(float value, Frac& frac);
-        friend Frac operator*(const char* value, Frac& frac);
+        template <typename T, typename = detail::EnableIfInteger<T>> friend constexpr BasicFrac operator*(T value, const BasicFrac& frac) { return BasicFrac(value) * frac; }
+        friend BasicFrac operator*(float value, const BasicFrac& frac) { return fromOperand(value) * frac; }
+        friend BasicFrac operator*(const char* value, const BasicFrac& frac) { return fromOperand(value) * frac; }
 
-        friend Frac operator/(int value, const Frac& frac);
-        friend Frac operator/(float value, Frac& frac);
-        friend Frac operator/(const char* value, Frac& frac);
+        template <typename T, typename = detail::EnableIfInteger<T>> friend constexpr BasicFrac operator/(T value, const BasicFrac& frac) { return BasicFrac(value) / frac; }
+        friend BasicFrac operator/(float value, const BasicFrac& frac) { return fromOperand(value) / frac; }
+        friend BasicFrac operator/(const char* value, const BasicFrac& frac) { return fromOperand(value) / frac; }
         
         // Compound
-        void operator+=(const Frac& other);
-        void operator+=(int value);
-        void operator+=(float value);
-        void operator+=(const char* value);
-
-        void operator-=(const Frac& other);
-        void operator-=(int value);
-        void operator-=(float value);
-        void operator-=(const char* value);
-
-        void operator*=(const Frac& other);
-        void operator*=(int value);
-        void operator*=(float value);
-        void operator*=(const char* value);
-
-        void operator/=(const Frac& other);
-        void operator/=(int value);
-        void operator/=(float value);
-        void operator/=(const char* value);
+        constexpr BasicFrac& operator+=(const BasicFrac& other);
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac& operator+=(T value);
+        BasicFrac& operator+=(float value);
+        BasicFrac& operator+=(const char* value);
+
+        constexpr BasicFrac& operator-=(const BasicFrac& other);
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac& operator-=(T value);
+        BasicFrac& operator-=(float value);
+        BasicFrac& operator-=(const char* value);
+
+        constexpr BasicFrac& operator*=(const BasicFrac& other);
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac& operator*=(T value);
+        BasicFrac& operator*=(float value);
+        BasicFrac& operator*=(const char* value);
+
+        constexpr BasicFrac& operator/=(const BasicFrac& other);
+        template <typename T, typename = detail::EnableIfInteger<T>> constexpr BasicFrac& operator/=(T value);
+        BasicFrac& operator/=(float value);
+        BasicFrac& operator/=(const char* value);
         
         // Increment/Decrement Post/Pre
-        Frac& operator++();
-        Frac& operator--();
-        Frac operator++(int);
-        Frac operator--(int);
+        constexpr BasicFrac& operator++();
+        constexpr BasicFrac& operator--();
+        constexpr BasicFrac operator++(int);
+        constexpr BasicFrac operator--(int);
 
         // Unary
-        Frac operator-();
+        constexpr BasicFrac operator-() const;
 
         // Comparision
-        bool operator==(const Frac& other) const;
+        // Fractions compare by value (1/2 == 2/4) and the result is exact for any stored values,
+        // including unreduced fractions and negative denominators.
+        constexpr bool operator==(const BasicFrac& other) const noexcept;
         bool operator==(float other) const;
         bool operator==(const char* other) const;
-        friend bool operator==(float other, Frac& frac);
-        friend bool operator==(const char* other, Frac& frac);
+        friend bool operator==(float other, const BasicFrac& frac) { return fromOperand(other) == frac; }
+        friend bool operator==(const char* other, const BasicFrac& frac) { return fromOperand(other) == frac; }
 
-        bool operator!=(const Frac& other) const;
+        constexpr bool operator!=(const BasicFrac& other) const noexcept;
         bool operator!=(float other) const;
         bool operator!=(const char* other) const;
-        friend bool operator!=(float other, Frac& frac);
-        friend bool operator!=(const char* other, Frac& frac);
+        friend bool operator!=(float other, const BasicFrac& frac) { return fromOperand(other) != frac; }
+        friend bool operator!=(const char* other, const BasicFrac& frac) { return fromOperand(other) != frac; }
 
-        bool operator>=(const Frac& other) const;
+        constexpr bool operator>=(const BasicFrac& other) const noexcept;
         bool operator>=(float other) const;
         bool operator>=(const char* other) const;
-        friend bool operator>=(float other, Frac& frac);
-        friend bool operator>=(const char* other, Frac& frac);
+        friend bool operator>=(float other, const BasicFrac& frac) { return fromOperand(other) >= frac; }
+        friend bool operator>=(const char* other, const BasicFrac& frac) { return fromOperand(other) >= frac; }
 
-        bool operator<=(const Frac& other) const;
+        constexpr bool operator<=(const BasicFrac& other) const noexcept;
         bool operator<=(float other) const;
         bool operator<=(const char* other) const;
-        friend bool operator<=(float other, Frac& frac);
-        friend bool operator<=(const char* other, Frac& frac);
+        friend bool operator<=(float other, const BasicFrac& frac) { return fromOperand(other) <= frac; }
+        friend bool operator<=(const char* other, const BasicFrac& frac) { return fromOperand(other) <= frac; }
 
-        bool operator>(const Frac& other) const;
+        constexpr bool operator>(const BasicFrac& other) const noexcept;
         bool operator>(float other) const;
         bool operator>(const char* other) const;
-        friend bool operator>(float other, Frac& frac);
-        friend bool operator>(const char* other, Frac& frac);
+        friend bool operator>(float other, const BasicFrac& frac) { return fromOperand(other) > frac; }
+        friend bool operator>(const char* other, const BasicFrac& frac) { return fromOperand(other) > frac; }
 
-        bool operator<(const Frac& other) const;
+        constexpr bool operator<(const BasicFrac& other) const noexcept;
         bool operator<(float other) const;
         bool operator<(const char* other) const;
-        friend bool operator<(float other, Frac& frac);
-        friend bool operator<(const char* other, Frac& frac);
+        friend bool operator<(float other, const BasicFrac& frac) { return fromOperand(other) < frac; }
+        friend bool operator<(const char* other, const BasicFrac& frac) { return fromOperand(other) < frac; }
+
+#ifdef FRACLIB_HAS_THREE_WAY_COMPARISON
+        /// @brief Three-way comparison (C++20). The ordering is weak since equal values may be stored differently.
+        constexpr std::weak_ordering operator<=>(const BasicFrac& other) const noexcept;
+#endif
 
         // Assignment
-        Frac& operator=(const Frac& other);
-        Frac& operator=(const char* str);
-        Frac& operator=(float decimal);
+        constexpr BasicFrac& operator=(const BasicFrac& other) noexcept = default;
+        constexpr BasicFrac& operator=(BasicFrac&& other) noexcept = default;
+        BasicFrac& operator=(const char* str);
+        BasicFrac& operator=(float decimal);
 
         // Insertion/Extraction
-        friend std::ostream& operator<<(std::ostream& os, const Frac& frac);
-        friend std::istream& operator>>(std::istream& is, Frac& frac);
+        friend std::ostream& operator<<(std::ostream& os, const BasicFrac& frac) { return writeToStream(os, frac); }
+        friend std::istream& operator>>(std::istream& is, BasicFrac& frac) { return readFromStream(is, frac); }
+
+    public: // METHODS
+        /// @brief Checks whether the fraction is in lowest terms with a positive denominator,
+        /// the form `Simplify` produces. Integers and zero are checked without a GCD.
+        /// @example if (!f.isCanonical()) Frac::SimplifyFrac(f);
+        constexpr bool isCanonical() const noexcept;
+        /// @brief Hash of the value, computed from the reduced form so fractions that compare equal
+        /// (ie. 1/2 and 2/4) hash equally. Integers and zero skip the GCD. Used by `std::hash`.
+        constexpr std::size_t hash() const noexcept;
 
     public: // STATIC METHODS
         
         /// @brief Best use is for inline math operations. Simplifies a Frac object using GCD(Greatest Common Divisor).
         /// @param frac Frac value object.
-        static Frac Simplify(Frac frac);
+        static constexpr BasicFrac Simplify(BasicFrac frac);
         /// @brief Best use is for straight-forward simplification. Simplifies a Frac object using GCD(Greatest Common Divisor).
         /// @param frac Frac reference object.
-        static void SimplifyFrac(Frac& frac);
+        static constexpr void SimplifyFrac(BasicFrac& frac);
+        /// @brief Compares the values of two fractions without overflow.
+        /// Equal denominators and differing signs are decided without multiplying. Otherwise the cross
+        /// products are compared in the widened type, or for the widest type through the continued
+        /// fraction expansions of both values.
+        /// @return negative if `a < b`, zero if they are equal and positive if `a > b`.
+        /// @example std::sort(v.begin(), v.end(), [](const Frac& a, const Frac& b) { return Frac::compare(a, b) < 0; });
+        static constexpr int compare(const BasicFrac& a, const BasicFrac& b) noexcept;
+        /// @brief Simplifies `count` fractions in place, with the same sign normalization as `Simplify`.
+        /// For `Frac` the GCDs are computed 16, 8 or 4 at a time with AVX-512, AVX2 or NEON, chosen at run time.
+        /// Never throws: a fraction that cannot be normalized is left unchanged and reported.
+        /// @param status optional array of `count` per-fraction results (`None` or `Overflow`).
+        /// @return number of fractions that could not be normalized.
+        /// @example Frac::SimplifyBatch(values.data(), values.size());
+        static std::size_t SimplifyBatch(BasicFrac* data, std::size_t count, FracError* status = nullptr) noexcept;
         /// @brief Converts a Frac object to a string (ie. "1/2").
         /// @param frac Frac object
         /// @return fraction as string
-        static std::string toString(const Frac& frac);
-        static float toFloat(const Frac& frac);
+        static std::string toString(const BasicFrac& frac);
+        /// @brief Writes a fraction to `[first, last)` without allocating, like `std::to_chars`.
+        /// @param frac Frac object.
+        /// @param isMixed write improper fractions as mixed numbers (ie. "3 1/2", "-1 1/4", "2", "1/2").
+        /// @return `ptr` one past the last character written, or `{last, std::errc::value_too_large}`
+        /// if the buffer is too small. `MAX_CHARS` always suffices. No terminating null is written.
+        /// @example char buf[Frac::MAX_CHARS]; auto [end, ec] = Frac::toChars(buf, buf + sizeof(buf), f);
+        static std::to_chars_result toChars(char* first, char* last, const BasicFrac& frac, bool isMixed = false) noexcept;
+        /// @brief Writes `count` fractions into one buffer, each followed by `separator`.
+        /// @param isMixed write improper fractions as mixed numbers.
+        /// @return on `std::errc::value_too_large`, `ptr` and `count` describe the values completely written,
+        /// so the caller can flush the buffer and continue from `fracs + count`.
+        static FracWriteResult toCharsBulk(char* first, char* last, const BasicFrac* fracs, std::size_t count,
+            char separator = '\n', bool isMixed = false) noexcept;
+        static constexpr float toFloat(const BasicFrac& frac);
         /// @brief Converts a fraction to a floating decimal.
         /// @param frac Frac object.
         /// @return fraction as float.
-        static double toDouble(const Frac& frac);
+        static constexpr double toDouble(const BasicFrac& frac);
+        /// @brief Converts a double to the closest fraction whose denominator is at most `maxDenominator`
+        /// (best rational approximation from its continued fraction expansion). No allocation or strings are involved.
+        /// @param value decimal to convert.
+        /// @param maxDenominator largest denominator allowed, defaults to the largest `IntT`.
+        /// @throws std::overflow_error if the result does not fit in `IntT`.
+        /// @throws std::invalid_argument if `value` is infinite or NaN, or `maxDenominator` is less than 1.
+        /// @example Frac pi = Frac::fromDouble(3.14159265358979, 1000); // 355/113
+        static BasicFrac fromDouble(double value, IntT maxDenominator = detail::IntTraits<IntT>::max);
+        /// @brief Parses "numerator/denominator", "numerator" or "whole numerator/denominator" without allocating.
+        /// An optional leading '-' negates the value. Surrounding whitespace is ignored.
+        /// @param str text holding exactly one fraction.
+        /// @param isSimplifying Determines whether the fraction will simplify or not.
+        /// @throws std::invalid_argument if the string is not properly formatted or if the denominator is zero.
+        /// @throws std::overflow_error if a value does not fit in `IntT`.
+        /// @example Frac f = Frac::parse("3 1/2"); // 7/2
+        static constexpr BasicFrac parse(std::string_view str, bool isSimplifying = false);
         /// @brief Returns the reciprocal of a fraction as a new Frac object.
         /// @param frac fraction to get reciprocal of
         /// @return fraction reciprocal
-        static Frac toReciprocal(const Frac& frac);
+        static constexpr BasicFrac toReciprocal(const BasicFrac& frac);
+        /// @brief Fused multiply-add: computes `a * b + c` in the widened type and narrows once at the end,
+        /// so `a * b` only has to fit in the widened type rather than in `IntT`.
+        /// @throws std::overflow_error if the reduced result does not fit in `IntT`.
+        /// @example Frac total = Frac::fma(price, quantity, shipping);
+        static constexpr BasicFrac fma(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c);
+        /// @brief Computes `a * b + c * d` in the widened type and narrows once at the end.
+        /// @throws std::overflow_error if the reduced result does not fit in `IntT`.
+        /// @example Frac blended = Frac::dot2(weightA, priceA, weightB, priceB);
+        static constexpr BasicFrac dot2(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, const BasicFrac& d);
+
+    public: // NON-THROWING API
+        // Every function below returns `FracError::None` and writes `out` on success. On failure the
+        // error is returned and `out` is left unchanged. `out` may alias an input.
+        // The throwing operators above are implemented on top of these.
+
+        /// @brief Creates `n/d`.
+        /// @param isSimplifying Determines whether the fraction will attempt to simplify or not.
+        /// @return `ZeroDivisor` if `d` is zero.
+        /// @example Frac f; if (Frac::tryMake(3, 4, f) != FracError::None) { ... }
+        static constexpr FracError tryMake(IntT n, IntT d, BasicFrac& out, bool isSimplifying = false) noexcept;
+        /// @brief Creates the whole number `n`.
+        /// @return `Overflow` if `n` does not fit in `IntT`.
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        static constexpr FracError tryMake(T n, BasicFrac& out) noexcept;
+        /// @brief Converts a fraction of another storage width to this one.
+        /// @return `Overflow` if the reduced value does not fit in `IntT`.
+        template <typename OtherIntT>
+        static constexpr FracError tryConvert(const BasicFrac<OtherIntT>& other, BasicFrac& out) noexcept;
+        /// @brief Computes `a + b`.
+        /// @return `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError tryAdd(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept;
+        /// @brief Computes `a - b`.
+        /// @return `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError trySub(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept;
+        /// @brief Computes `a * b`.
+        /// @return `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError tryMul(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept;
+        /// @brief Computes `a / b`.
+        /// @return `ZeroDivisor` if `b` is zero, `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError tryDiv(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept;
+        /// @brief Non-throwing form of `fma`, computes `a * b + c`.
+        /// @return `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError tryFma(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, BasicFrac& out) noexcept;
+        /// @brief Non-throwing form of `dot2`, computes `a * b + c * d`.
+        /// @return `Overflow` if the reduced result does not fit in `IntT`.
+        static constexpr FracError tryDot2(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, const BasicFrac& d, BasicFrac& out) noexcept;
+        /// @brief Computes `-a`.
+        /// @return `Overflow` if the reduced negation does not fit in `IntT`.
+        static constexpr FracError tryNegate(const BasicFrac& a, BasicFrac& out) noexcept;
+        /// @brief Computes `1 / a` with a positive denominator.
+        /// @return `ZeroDivisor` if `a` is zero.
+        static constexpr FracError tryReciprocal(const BasicFrac& a, BasicFrac& out) noexcept;
+        /// @brief Simplifies `frac` in place.
+        /// @return `Overflow` if the sign cannot be moved to the numerator.
+        static constexpr FracError trySimplify(BasicFrac& frac) noexcept;
+        /// @brief Non-throwing form of `parse`. The whole string must be one fraction.
+        /// @param isSimplifying Determines whether the fraction will simplify or not.
+        /// @return `InvalidString`, `ZeroDivisor` or `Overflow` on failure.
+        static constexpr FracError tryParse(std::string_view str, BasicFrac& out, bool isSimplifying = false) noexcept;
+        /// @brief Parses one fraction from the front of `[first, last)`, like `std::from_chars`.
+        /// Leading blanks are skipped and parsing stops at the first character that cannot continue the
+        /// fraction, so "1/2,3/4" stops at ','. No allocation, locale or stream is involved.
+        /// @return `ptr` is one past the fraction on success, or where the error was detected.
+        /// @example auto [ptr, error] = Frac::fromChars(line.data(), line.data() + line.size(), f);
+        static constexpr FracParseResult fromChars(const char* first, const char* last, BasicFrac& out, bool isSimplifying = false) noexcept;
+        /// @brief Parses text the way `operator>>` reads a line: surrounding whitespace is trimmed, then it is
+        /// read as a fraction ("3/4", "3 1/2") or a decimal ("0.125", "-1.5e-3"), in lowest terms. Decimals are
+        /// converted exactly, without the `strtod` fallback of `tryParseDecimal`, so this is `constexpr`.
+        /// @return `InvalidString`, `ZeroDivisor`, or `Overflow` if the value does not fit exactly in `IntT`.
+        /// @example constexpr Frac half = [] { Frac f; Frac::tryParseExact("0.5", f); return f; }();
+        static constexpr FracError tryParseExact(std::string_view str, BasicFrac& out) noexcept;
+        /// @brief Converts a decimal to a simplified fraction, as the `float` constructor does.
+        /// @return `Overflow` if the decimal does not fit in `IntT`, `NotFinite` for infinity or NaN.
+        static FracError tryFromFloat(float decimal, BasicFrac& out) noexcept;
+        /// @brief Converts a double to the exact dyadic fraction `mantissa / 2^k` it stores, in lowest terms.
+        /// @return `Overflow` if the exact value does not fit in `IntT`, `NotFinite` for infinity or NaN.
+        /// @example Frac f; Frac::tryFromDouble(0.1, f); // Overflow, 0.1 is 3602879701896397/36028797018963968
+        static FracError tryFromDouble(double value, BasicFrac& out) noexcept;
+        /// @brief Non-throwing form of `fromDouble`.
+        /// @return `Overflow`, `NotFinite`, or `ZeroDivisor` if `maxDenominator` is less than 1.
+        static FracError tryFromDouble(double value, IntT maxDenominator, BasicFrac& out) noexcept;
+        /// @brief Closest fraction to `value` with a denominator of at most `maxDenominator`, in lowest terms,
+        /// found from the continued fraction convergents and semiconvergents of `value`.
+        /// @return `ZeroDivisor` if `maxDenominator` is less than 1 or `value` has a zero denominator.
+        /// @example Frac f; Frac::tryLimitDenominator(Frac(355, 113), 100, f); // 311/99
+        static FracError tryLimitDenominator(const BasicFrac& value, IntT maxDenominator, BasicFrac& out) noexcept;
+        /// @brief Parses decimal text such as "-12.375" or "1.5e-3" exactly (as `tryParseExact` does), falling
+        /// back to `strtod` and `tryFromDouble` for values that do not fit exactly in `IntT`.
+        /// @return `InvalidString` if the whole string is not a decimal, or the error of `tryFromDouble`.
+        /// @example Frac f; Frac::tryParseDecimal("-12.375", f); // -99/8
+        static FracError tryParseDecimal(std::string_view str, BasicFrac& out);
 
     private: // PRIVATE FUNCTIONS
+        /// @brief Adds or subtracts using Henrici's method: the denominators are divided by their GCD
+        /// before cross multiplying and only the remaining common factor is cancelled afterwards.
+        /// @param isSubtracting computes `lhs - rhs` instead of `lhs + rhs`.
+        static constexpr FracError addReduced(const BasicFrac& lhs, const BasicFrac& rhs, bool isSubtracting, BasicFrac& out) noexcept;
+        /// @brief Multiplies `n1/d1` by `n2/d2` after cancelling `gcd(n1, d2)` and `gcd(n2, d1)`.
+        static constexpr FracError mulReduced(IntT n1, IntT d1, IntT n2, IntT d2, BasicFrac& out) noexcept;
+        /// @brief Cross-reduced product `n/d` of `n1/d1` and `n2/d2`, kept in the widened type.
+        /// @return true on overflow, which is only possible when `IntT` is already the widest type.
+        static constexpr bool productWide(IntT n1, IntT d1, IntT n2, IntT d2,
+            typename detail::IntTraits<IntT>::Wide& n, typename detail::IntTraits<IntT>::Wide& d) noexcept;
+        /// @brief Adds two widened fractions with Henrici's method and narrows the sum with `fromWide`.
+        /// @return `Overflow` if an intermediate value or the reduced sum does not fit.
+        template <typename WideT>
+        static constexpr FracError sumWide(WideT n1, WideT d1, WideT n2, WideT d2, BasicFrac& out) noexcept;
+        /// @brief Narrows a widened intermediate result back to `IntT` in lowest terms with a positive denominator.
+        /// @param n widened numerator.
+        /// @param d widened denominator.
+        /// @param isReducing false to keep a value that fits unreduced (conversions), true for arithmetic results.
+        /// @return `ZeroDivisor` if `d` is zero, `Overflow` if the reduced value does not fit in `IntT`.
+        template <typename WideT>
+        static constexpr FracError fromWide(WideT n, WideT d, BasicFrac& out, bool isReducing = true) noexcept;
+        /// @brief Writes "numerator/denominator" to an output stream.
+        static std::ostream& writeToStream(std::ostream& os, const BasicFrac& frac);
+        /// @brief Reads a decimal or string fraction from an input stream.
+        static std::istream& readFromStream(std::istream& is, BasicFrac& frac);
+        /// @brief Body of `fromChars`, which counts the parse in `FracStats`.
+        static constexpr FracParseResult parseChars(const char* first, const char* last, BasicFrac& out, bool isSimplifying) noexcept;
+        /// @brief Parses all of `str` as `[-]digits[.digits][e[+-]digits]` exactly, in lowest terms.
+        /// @return `InvalidString` for any other text, `Overflow` if the value does not fit in `IntT`.
+        static constexpr FracError parseExactDecimal(std::string_view str, BasicFrac& out) noexcept;
+        /// @brief Body of `toChars`, which counts the write in `FracStats`.
+        static std::to_chars_result writeChars(char* first, char* last, const BasicFrac& frac, bool isMixed) noexcept;
+        /// @brief Fraction of a `float` or string operand of a mixed operator, looked up in the conversion
+        /// cache of the calling thread when it is enabled (see frac_cache.h).
+        /// @throws the errors of the matching constructor, which are never cached.
+        static BasicFrac fromOperand(float value);
+        static BasicFrac fromOperand(const char* value);
         /// @brief Simplifies this object fraction(numerator/denominator) using GCD method.
-        void simplify();
-        /// @brief Parses input stream fractions to Frac members numerator and denominator.
-        /// @param is input stream.
-        /// @param simplify optional, simplify fraction.
-        void parseFromStream(std::istream& is, bool isSimplifying = false);
-        /// @brief Converts a decimal into a Frac by assigning the numerator and denominator
-        /// to this Frac object. The Frac is simplified.
-        /// @param decimal decimal to convert to fraction.
-        void toFrac(float decimal);
+        constexpr void simplify();
+        /// @brief Closest fraction to the widened `n/d` with a denominator of at most `maxDenominator`.
+        /// @param error set to `|n/d - out|` on success.
+        /// @return `ZeroDivisor` if `d` is zero or `maxDenominator` is less than 1, `Overflow` if the integer
+        /// part of `n/d` does not fit in `IntT`.
+        static FracError roundWide(typename detail::IntTraits<IntT>::Wide n, typename detail::IntTraits<IntT>::Wide d,
+            IntT maxDenominator, BasicFrac& out, double& error) noexcept;
+
+        friend class BasicFracContext<IntT>;
     };
+
+    /// @brief Fraction with 32-bit numerator and denominator.
+    using Frac = BasicFrac<int>;
+    /// @brief Fraction with 64-bit numerator and denominator.
+    using Frac64 = BasicFrac<std::int64_t>;
+#ifdef FRACLIB_HAS_INT128
+    /// @brief Fraction with 128-bit numerator and denominator.
+    using Frac128 = BasicFrac<__int128>;
+#endif
+
+    static_assert(std::is_trivially_copyable<Frac>::value, "Frac must stay trivially copyable.");
 }
 
+namespace std {
+    /// @brief Hashes fractions by value, so `1/2` and `2/4` are the same key (see `BasicFrac::hash`).
+    /// @example std::unordered_map<FracLib::Frac, int> counts;
+    template <typename IntT>
+    struct hash<FracLib::BasicFrac<IntT>> {
+        std::size_t operator()(const FracLib::BasicFrac<IntT>& frac) const noexcept { return frac.hash(); }
+    };
+}
 
+// Core arithmetic, comparison and simplification (constexpr, always inline)
+#include "frac_inline.h"
+#include "frac_literals.h"
+#include "frac_context.h"
+
+// Conversions, parsing and stream support (inline only in header-only mode)
+// The archive provides the common instantiations, other types need header-only mode.
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_impl.h"
+    #include "frac_kernels.h"
+#else
+namespace FracLib {
+    extern template class BasicFrac<int>;
+    extern template class BasicFrac<std::int64_t>;
+#ifdef FRACLIB_HAS_INT128
+    extern template class BasicFrac<__int128>;
+#endif
+}
+#endif
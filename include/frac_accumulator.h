@@ -0,0 +1,202 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_accumulator.h
+ * Description:
+ *  This header file defines `FracAccumulator`, an exact running sum that
+ *  many threads can add into at once.
+ *
+ *  Every thread that adds gets its own shard, found through a small
+ *  thread-local table, so threads never write the same memory. A shard
+ *  keeps its sum as an unreduced `n/d` in the widest native integer
+ *  (`__int128` where available): `d` is the lcm of the denominators it has
+ *  seen and is never reduced against `n`, so adding a value whose
+ *  denominator divides `d` is a multiply and an add, with no GCD. When a
+ *  part would overflow, the shard moves its sum into a `BigFrac` and starts
+ *  over, so the total never overflows.
+ *
+ *  `snapshot()` combines the shards into one `BigFrac`, reducing once at the
+ *  end, and `merge()` does the same while emptying the shards. Each shard
+ *  has a flag that its owner sets around an addition and a snapshot sets
+ *  while it reads the shard; only those two ever contend for it.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_big.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+#ifdef FRACLIB_HAS_INT128
+        /// @brief Storage of the unreduced shard sums.
+        using AccumulatorInt = __int128;
+#else
+        using AccumulatorInt = std::int64_t;
+#endif
+        /// @brief Accumulators a thread remembers its shard for. Using more in turn costs a locked lookup.
+        constexpr std::size_t ACCUMULATOR_SLOTS = 8;
+
+        /// @brief Per-thread shard of one `FracAccumulator`, on its own cache line.
+        struct alignas(64) AccumulatorShard {
+            std::atomic<bool> isBusy{false};
+            AccumulatorInt numerator = 0;
+            AccumulatorInt denominator = 1;
+            BigFrac overflow;      ///< Sums moved out of `numerator / denominator` when they would overflow.
+            bool hasOverflow = false;
+            std::thread::id owner;
+
+            void lock() noexcept {
+                while (this->isBusy.exchange(true, std::memory_order_acquire)) {
+                    while (this->isBusy.load(std::memory_order_relaxed)) std::this_thread::yield();
+                }
+            }
+            void unlock() noexcept { this->isBusy.store(false, std::memory_order_release); }
+
+            /// @brief Adds `n/d` (`d > 0`) to the unreduced sum, or returns false if a part would overflow.
+            bool tryAddSmall(std::int64_t n, std::int64_t d) noexcept {
+                if (d == this->denominator) {
+                    return !addOverflow(this->numerator, static_cast<AccumulatorInt>(n), this->numerator);
+                }
+                // n/d joins at lcm(denominator, d); one remainder brings the GCD down to 64 bits
+                using Unsigned = std::uint64_t;
+                const Unsigned gcdValue = gcd(static_cast<Unsigned>(this->denominator % d), static_cast<Unsigned>(d));
+                const AccumulatorInt scale = static_cast<AccumulatorInt>(static_cast<Unsigned>(d) / gcdValue);
+                const AccumulatorInt other = this->denominator / static_cast<AccumulatorInt>(gcdValue);
+                AccumulatorInt left = 0, right = 0, sum = 0, lcm = 0;
+                if (mulOverflow(this->numerator, scale, left) || mulOverflow(static_cast<AccumulatorInt>(n), other, right) ||
+                    addOverflow(left, right, sum) || mulOverflow(this->denominator, scale, lcm)) {
+                    return false;
+                }
+                this->numerator = sum;
+                this->denominator = lcm;
+                return true;
+            }
+        };
+
+        struct AccumulatorSlot {
+            std::uint64_t id = 0;
+            AccumulatorShard* shard = nullptr;
+        };
+        /// @brief Shards of the accumulators the current thread used last. Ids are never reused, so
+        /// entries of destroyed accumulators never match again.
+        inline thread_local AccumulatorSlot accumulatorSlots[ACCUMULATOR_SLOTS];
+        inline thread_local std::size_t nextAccumulatorSlot = 0;
+        inline std::atomic<std::uint64_t> nextAccumulatorId{1};
+    }
+
+
+    /// @brief Exact sum that any number of threads can add into concurrently.
+    /// @example FracLib::FracAccumulator total; workers.emplace_back([&] { total += Frac(1, 3); }); BigFrac sum = total.snapshot();
+    class FracAccumulator {
+    public: // CONSTRUCTORS
+        FracAccumulator();
+        FracAccumulator(const FracAccumulator&) = delete;
+        FracAccumulator& operator=(const FracAccumulator&) = delete;
+
+    public: // ADDING
+        /// @brief Adds `value` to the shard of the calling thread. Never overflows.
+        /// @return `ZeroDivisor` if `value` has a zero denominator, leaving the sum unchanged.
+        template <typename IntT>
+        FracError tryAdd(const BasicFrac<IntT>& value);
+
+        /// @brief Adds `value` to the shard of the calling thread.
+        /// @throws std::invalid_argument if `value` has a zero denominator (`FracError::ZeroDivisor`).
+        template <typename IntT>
+        FracAccumulator& operator+=(const BasicFrac<IntT>& value) {
+            detail::throwOnError(this->tryAdd(value));
+            return *this;
+        }
+
+    public: // TOTALS
+        // Additions that run concurrently with these calls may or may not be included.
+
+        /// @brief Sum of every shard, in lowest terms. The shards are left as they are.
+        BigFrac snapshot() const;
+        /// @brief Moves every shard into the running total and returns it, so later snapshots combine fewer values.
+        BigFrac merge();
+        /// @brief Sets the sum back to zero.
+        void reset();
+        /// @brief Threads that have added to this accumulator.
+        std::size_t shardCount() const;
+
+    private: // PRIVATE FUNCTIONS
+        /// @brief Shard of the calling thread, registered on first use.
+        detail::AccumulatorShard& localShard() {
+            for (detail::AccumulatorSlot& slot : detail::accumulatorSlots) {
+                if (slot.id == this->id) return *slot.shard;
+            }
+            return this->registerThread();
+        }
+        detail::AccumulatorShard& registerThread();
+        /// @brief Adds a value that does not fit the narrow path of `tryAdd`, with the shard locked.
+        static void addLarge(detail::AccumulatorShard& shard, const BigFrac& value);
+        /// @brief Moves the unreduced sum of a locked shard into its `BigFrac` and restarts it at `n/d`.
+        static void spill(detail::AccumulatorShard& shard, std::int64_t n, std::int64_t d);
+        /// @brief Sum of the shards without `total`, emptying them if `isDraining`. Needs `registryMutex`.
+        BigFrac combine(bool isDraining) const;
+
+    private: // ATTRIBUTES
+        const std::uint64_t id;
+        mutable std::mutex registryMutex;   ///< Guards `shards` and `total`, never taken by additions.
+        std::vector<std::unique_ptr<detail::AccumulatorShard>> shards;
+        BigFrac total;                      ///< Shards moved here by `merge()`.
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Inline Definitions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    FracError FracAccumulator::tryAdd(const BasicFrac<IntT>& value) {
+        if (value.denominator == 0) {
+            return FracError::ZeroDivisor;
+        }
+        detail::AccumulatorShard& shard = this->localShard();
+        // Keeps the lock released if a spill fails to allocate
+        struct Guard {
+            detail::AccumulatorShard& shard;
+            ~Guard() { shard.unlock(); }
+        };
+        shard.lock();
+        const Guard guard{shard};
+
+        std::int64_t n = 0, d = 0;
+        if (detail::fitsIn<std::int64_t>(value.numerator) && detail::fitsIn<std::int64_t>(value.denominator) &&
+            value.numerator != detail::IntTraits<std::int64_t>::min && value.denominator != detail::IntTraits<std::int64_t>::min) {
+            n = static_cast<std::int64_t>(value.numerator);
+            d = static_cast<std::int64_t>(value.denominator);
+            if (d < 0) {
+                n = -n;
+                d = -d;
+            }
+            if (!shard.tryAddSmall(n, d)) spill(shard, n, d);
+        } else {
+            addLarge(shard, BigFrac(value));
+        }
+        return FracError::None;
+    }
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_accumulator.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_accumulator_impl.h"
+#endif
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_accumulator_impl.h
+ * Description:
+ *  This header file implements the shard registry and the snapshots of
+ *  `FracAccumulator` declared in `frac_accumulator.h`.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by
+ *  `frac_accumulator.h`. Otherwise `src/frac_accumulator.cpp` compiles it
+ *  into the static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_accumulator.h"
+#include <utility>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracAccumulator::FracAccumulator() : id(detail::nextAccumulatorId.fetch_add(1, std::memory_order_relaxed)) {}
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Totals
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigFrac FracAccumulator::snapshot() const {
+        const std::lock_guard<std::mutex> registryLock(this->registryMutex);
+        return this->combine(false) + this->total;
+    }
+
+    FRACLIB_INLINE BigFrac FracAccumulator::merge() {
+        const std::lock_guard<std::mutex> registryLock(this->registryMutex);
+        this->total += this->combine(true);
+        return this->total;
+    }
+
+    FRACLIB_INLINE void FracAccumulator::reset() {
+        const std::lock_guard<std::mutex> registryLock(this->registryMutex);
+        for (const std::unique_ptr<detail::AccumulatorShard>& shard : this->shards) {
+            shard->lock();
+            shard->numerator = 0;
+            shard->denominator = 1;
+            shard->overflow = BigFrac();
+            shard->hasOverflow = false;
+            shard->unlock();
+        }
+        this->total = BigFrac();
+    }
+
+    FRACLIB_INLINE std::size_t FracAccumulator::shardCount() const {
+        const std::lock_guard<std::mutex> registryLock(this->registryMutex);
+        return this->shards.size();
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE detail::AccumulatorShard& FracAccumulator::registerThread() {
+        const std::thread::id self = std::this_thread::get_id();
+        detail::AccumulatorShard* found = nullptr;
+        {
+            const std::lock_guard<std::mutex> registryLock(this->registryMutex);
+            // A thread that dropped this accumulator from its slots gets its old shard back
+            for (const std::unique_ptr<detail::AccumulatorShard>& shard : this->shards) {
+                if (shard->owner == self) {
+                    found = shard.get();
+                    break;
+                }
+            }
+            if (found == nullptr) {
+                this->shards.push_back(std::make_unique<detail::AccumulatorShard>());
+                found = this->shards.back().get();
+                found->owner = self;
+            }
+        }
+        detail::AccumulatorSlot& slot = detail::accumulatorSlots[detail::nextAccumulatorSlot];
+        detail::nextAccumulatorSlot = (detail::nextAccumulatorSlot + 1) % detail::ACCUMULATOR_SLOTS;
+        slot.id = this->id;
+        slot.shard = found;
+        return *found;
+    }
+
+    FRACLIB_INLINE void FracAccumulator::addLarge(detail::AccumulatorShard& shard, const BigFrac& value) {
+        shard.overflow += value;
+        shard.hasOverflow = true;
+    }
+
+    FRACLIB_INLINE void FracAccumulator::spill(detail::AccumulatorShard& shard, std::int64_t n, std::int64_t d) {
+        shard.overflow += BigFrac(BigInt(shard.numerator), BigInt(shard.denominator));
+        shard.hasOverflow = true;
+        shard.numerator = n;
+        shard.denominator = d;
+    }
+
+    FRACLIB_INLINE BigFrac FracAccumulator::combine(bool isDraining) const {
+        // The unreduced shard sums join at the lcm of their denominators and are reduced once, at the end
+        BigInt numerator, denominator(1);
+        BigFrac overflows;
+        for (const std::unique_ptr<detail::AccumulatorShard>& shard : this->shards) {
+            shard->lock();
+            const detail::AccumulatorInt n = shard->numerator;
+            const detail::AccumulatorInt d = shard->denominator;
+            BigFrac overflow;
+            const bool hasOverflow = shard->hasOverflow;
+            if (isDraining) {
+                shard->numerator = 0;
+                shard->denominator = 1;
+                overflow = std::move(shard->overflow);
+                shard->overflow = BigFrac();
+                shard->hasOverflow = false;
+            } else if (hasOverflow) {
+                overflow = shard->overflow;
+            }
+            shard->unlock();
+
+            if (hasOverflow) overflows += overflow;
+            if (n == 0) continue;
+            const BigInt shardDenominator(d);
+            const BigInt gcdValue = BigInt::gcd(denominator, shardDenominator);
+            const BigInt scale = shardDenominator / gcdValue;
+            numerator = numerator * scale + BigInt(n) * (denominator / gcdValue);
+            denominator = denominator * scale;
+        }
+
+        return BigFrac(numerator, denominator) + overflows;
+    }
+}
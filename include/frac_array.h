@@ -0,0 +1,263 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_array.h
+ * Description:
+ *  This header file defines `FracArray`, a structure-of-arrays container of
+ *  `Frac` values. Numerators and denominators are kept in two separate
+ *  contiguous buffers so batch kernels can process many fractions per
+ *  instruction instead of one `Frac` operator call at a time.
+ *
+ *  The element-wise `add`, `sub`, `mul` and `div` kernels (with array or
+ *  scalar right-hand sides) compute every lane's cross products in 64-bit
+ *  lanes with AVX-512, AVX2 or NEON, selected at run time (see `frac_simd.h`).
+ *  Results that fit are stored without reduction; lanes that do not fit are
+ *  recomputed with the reducing scalar `Frac::try*` functions, so a lane only
+ *  fails where `Frac` itself would. Failures never throw: they are counted
+ *  and optionally reported per lane as a `FracError`. `simplifyAll` brings
+ *  every element to lowest terms with a lane-parallel binary GCD.
+ *
+ *  `compare` tests every element against a threshold with the same 64-bit
+ *  cross products as `Frac::compare` and packs the results into a
+ *  `FracMask`, one bit per element. Masks combine with `&=`, `|=` and
+ *  `flip()`, and `select` gathers the elements whose bit is set, so filters
+ *  run a whole column at a time. `countIf` only counts the matches.
+ *
+ *  Both buffers are allocated from a `std::pmr::memory_resource` (the
+ *  default resource unless one is given), so an array can live in a
+ *  `FracArena` (see `frac_memory.h`).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory_resource>
+#include <vector>
+
+namespace FracLib {
+    /// @brief Read-only, non-owning view of numerator and denominator columns, such as a `FracArray`
+    /// or a `MappedFracArray` (see `frac_binary.h`). Batch kernels, reductions and searches take views,
+    /// so they run on either without copying.
+    class FracArrayView {
+    public: // TYPES
+        using value_type = Frac;
+        using size_type = std::size_t;
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Creates an empty view.
+        constexpr FracArrayView() noexcept : numeratorData(nullptr), denominatorData(nullptr), count(0) {}
+        /// @brief Views `count` fractions stored as two columns.
+        /// @example FracArrayView view(numerators, denominators, 1000);
+        constexpr FracArrayView(const int* numerators, const int* denominators, size_type count) noexcept :
+            numeratorData(numerators), denominatorData(denominators), count(count) {}
+
+    public: // ACCESS
+        constexpr size_type size() const noexcept { return this->count; }
+        constexpr bool empty() const noexcept { return this->count == 0; }
+        /// @brief Returns the fraction at `index` (unchecked).
+        constexpr Frac get(size_type index) const noexcept {
+            Frac result;
+            result.numerator = this->numeratorData[index];
+            result.denominator = this->denominatorData[index];
+            return result;
+        }
+        constexpr const int* numerators() const noexcept { return this->numeratorData; }
+        constexpr const int* denominators() const noexcept { return this->denominatorData; }
+
+    private: // ATTRIBUTES
+        const int* numeratorData;
+        const int* denominatorData;
+        size_type count;
+    };
+
+    /// @brief Comparison applied to every element by `FracArray::compare`, `countIf` and `select`.
+    enum class FracCompare : unsigned char {
+        Less,           ///< `value < threshold`
+        LessEqual,      ///< `value <= threshold`
+        Greater,        ///< `value > threshold`
+        GreaterEqual,   ///< `value >= threshold`
+        Equal,          ///< `value == threshold`
+        NotEqual        ///< `value != threshold`
+    };
+
+    /// @brief One bit per element of a `FracArray`, as produced by `FracArray::compare`. Bit `i` is bit
+    /// `i % 64` of word `i / 64`, and the bits past `size()` in the last word are always zero.
+    class FracMask {
+    public: // TYPES
+        using size_type = std::size_t;
+        using word_type = std::uint64_t;
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Creates an empty mask.
+        FracMask() noexcept = default;
+        /// @brief Creates an empty mask that allocates from `resource`.
+        explicit FracMask(std::pmr::memory_resource* resource) noexcept;
+        /// @brief Creates `count` bits, all set to `value`.
+        explicit FracMask(size_type count, bool value = false, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    public: // ACCESS
+        size_type size() const noexcept { return this->bitCount; }
+        bool empty() const noexcept { return this->bitCount == 0; }
+        /// @brief Resizes the mask, new bits are clear.
+        void resize(size_type count);
+        /// @brief Returns bit `index` (unchecked).
+        bool test(size_type index) const noexcept { return (this->wordValues[index / 64] >> (index % 64)) & 1; }
+        /// @brief Sets bit `index` to `value` (unchecked).
+        void set(size_type index, bool value = true) noexcept;
+        /// @brief Number of set bits.
+        size_type count() const noexcept;
+        /// @brief Contiguous buffer of `wordCount()` words.
+        word_type* words() noexcept { return this->wordValues.data(); }
+        const word_type* words() const noexcept { return this->wordValues.data(); }
+        size_type wordCount() const noexcept { return this->wordValues.size(); }
+
+    public: // OPERATORS
+        // `other` is read as if it had `size()` bits, missing bits being clear.
+
+        /// @brief Keeps the bits set in both masks, ie. to require two comparisons.
+        FracMask& operator&=(const FracMask& other) noexcept;
+        /// @brief Sets the bits set in either mask.
+        FracMask& operator|=(const FracMask& other) noexcept;
+        /// @brief Inverts every bit.
+        FracMask& flip() noexcept;
+
+    private: // PRIVATE FUNCTIONS
+        /// @brief Clears the bits past `size()` in the last word.
+        void clearTail() noexcept;
+
+    private: // ATTRIBUTES
+        std::pmr::vector<word_type> wordValues;
+        size_type bitCount = 0;
+    };
+
+    /// @brief Structure-of-arrays container of `Frac` values with batch arithmetic kernels.
+    /// Denominators are expected to be non-zero, as in `Frac`. Batch results equal the corresponding
+    /// `Frac` operator results in value but are only guaranteed to be in lowest terms after `simplifyAll`.
+    /// Copies use the default resource, as `std::pmr` containers do, unless another one is given.
+    class FracArray {
+    public: // TYPES
+        using value_type = Frac;
+        using size_type = std::size_t;
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Creates an empty array.
+        FracArray() = default;
+        /// @brief Creates an empty array that allocates from `resource`.
+        /// @example FracArena arena; FracArray values(&arena);
+        explicit FracArray(std::pmr::memory_resource* resource) noexcept;
+        /// @brief Creates `count` fractions initialized to `0/1`.
+        /// @example FracArray values(1000);
+        explicit FracArray(size_type count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        /// @brief Copies `count` fractions from `values`.
+        FracArray(const Frac* values, size_type count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        /// @brief Creates an array from a list of fractions.
+        /// @example FracArray values = {Frac(1, 2), Frac(3, 4)};
+        FracArray(std::initializer_list<Frac> values, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        FracArray(const FracArray& other) = default;
+        /// @brief Copies `other` into buffers allocated from `resource`.
+        FracArray(const FracArray& other, std::pmr::memory_resource* resource);
+        /// @brief Copies the fractions of `view`.
+        /// @example FracArray copy(mapped.view());
+        explicit FracArray(FracArrayView view, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        FracArray(FracArray&& other) noexcept = default;
+        // Assignment keeps the resource of the target
+        FracArray& operator=(const FracArray& other) = default;
+        FracArray& operator=(FracArray&& other) = default;
+
+    public: // ACCESS
+        size_type size() const noexcept { return numeratorValues.size(); }
+        bool empty() const noexcept { return numeratorValues.empty(); }
+        void reserve(size_type count);
+        /// @brief Resizes the array, new fractions are `0/1`.
+        void resize(size_type count);
+        void clear() noexcept;
+        void push_back(const Frac& value);
+        /// @brief Returns the fraction at `index` (unchecked).
+        Frac get(size_type index) const noexcept;
+        /// @brief Stores `value` at `index` (unchecked).
+        void set(size_type index, const Frac& value) noexcept;
+        /// @brief Contiguous numerator buffer of `size()` elements.
+        int* numerators() noexcept { return numeratorValues.data(); }
+        const int* numerators() const noexcept { return numeratorValues.data(); }
+        /// @brief Contiguous denominator buffer of `size()` elements.
+        int* denominators() noexcept { return denominatorValues.data(); }
+        const int* denominators() const noexcept { return denominatorValues.data(); }
+        /// @brief Memory resource both buffers are allocated from.
+        std::pmr::memory_resource* resource() const noexcept { return numeratorValues.get_allocator().resource(); }
+        /// @brief Read-only view of the current elements, invalidated when the array is resized.
+        FracArrayView view() const noexcept { return FracArrayView(numerators(), denominators(), size()); }
+        operator FracArrayView() const noexcept { return this->view(); }
+
+    public: // BATCH KERNELS
+        // Every kernel writes `out[i] = a[i] op b[i]` (or `a[i] op scalar`), resizing `out` to `a.size()`,
+        // and returns the number of lanes that failed. `a` and `b` may be any `FracArrayView` and `out` may be `a` or `b`. A failed lane holds `0/1`
+        // and, when `status` is not null, `status[i]` receives its `FracError` (`None` for every other lane).
+        // Array operands of different lengths are reported with `FracError::SizeMismatch` for lane 0
+        // and `out` is left unchanged.
+
+        /// @brief Element-wise `a + b`.
+        /// @param status optional array of `a.size()` per-lane results.
+        /// @return number of lanes that overflowed.
+        /// @example std::size_t failed = FracArray::add(prices, taxes, totals);
+        static size_type add(FracArrayView a, FracArrayView b, FracArray& out, FracError* status = nullptr);
+        /// @brief Adds `scalar` to every element of `a`.
+        static size_type add(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status = nullptr);
+        /// @brief Element-wise `a - b`.
+        static size_type sub(FracArrayView a, FracArrayView b, FracArray& out, FracError* status = nullptr);
+        /// @brief Subtracts `scalar` from every element of `a`.
+        static size_type sub(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status = nullptr);
+        /// @brief Element-wise `a * b`.
+        static size_type mul(FracArrayView a, FracArrayView b, FracArray& out, FracError* status = nullptr);
+        /// @brief Multiplies every element of `a` by `scalar`.
+        static size_type mul(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status = nullptr);
+        /// @brief Element-wise `a / b`. Lanes dividing by zero report `FracError::ZeroDivisor`.
+        static size_type div(FracArrayView a, FracArrayView b, FracArray& out, FracError* status = nullptr);
+        /// @brief Divides every element of `a` by `scalar`.
+        static size_type div(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status = nullptr);
+        /// @brief Simplifies every element in place, with the same sign normalization as `Frac::Simplify`.
+        /// Runs the same kernel as `Frac::SimplifyBatch` without repacking. Elements that cannot be
+        /// normalized are left unchanged.
+        /// @return number of elements that could not be normalized (`FracError::Overflow`).
+        static size_type simplifyAll(FracArray& array, FracError* status = nullptr);
+        /// @brief Name of the instruction set the kernels run with on this CPU ("avx512", "avx2", "neon" or "scalar").
+        static const char* kernelName() noexcept;
+
+    public: // PREDICATE KERNELS
+        // Elements are compared by value exactly as the `Frac` comparison operators do, for any stored
+        // fractions, including unreduced ones and negative denominators.
+
+        /// @brief Sets bit `i` of `out` when `a[i] op threshold`, resizing `out` to `a.size()`.
+        /// @return number of set bits.
+        /// @example FracMask cheap; FracArray::compare(prices, FracCompare::Less, Frac(3, 7), cheap);
+        static size_type compare(FracArrayView a, FracCompare op, const Frac& threshold, FracMask& out);
+        /// @brief Number of elements of `a` with `a[i] op threshold`, without storing a mask.
+        static size_type countIf(FracArrayView a, FracCompare op, const Frac& threshold) noexcept;
+        /// @brief Copies the elements of `a` whose bit is set in `mask` to `out`, in order. `out` may be `a`.
+        /// Elements past the end of `mask` are not selected.
+        /// @return number of elements copied, the new size of `out`.
+        static size_type select(FracArrayView a, const FracMask& mask, FracArray& out);
+        /// @brief Copies the elements of `a` with `a[i] op threshold` to `out`, in order. `out` may be `a`.
+        /// @example FracArray::select(ratios, FracCompare::GreaterEqual, Frac(3, 7), matches);
+        static size_type select(FracArrayView a, FracCompare op, const Frac& threshold, FracArray& out);
+
+    private: // ATTRIBUTES
+        std::pmr::vector<int> numeratorValues;
+        std::pmr::vector<int> denominatorValues;
+    };
+}
+
+// Kernels are inline only in header-only mode, the archive compiles them in src/frac_array.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_array_impl.h"
+#endif
@@ -0,0 +1,277 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_array_impl.h
+ * Description:
+ *  This header file implements `FracArray` and `FracMask`. The batch
+ *  operations check their operands and forward the numerator and
+ *  denominator buffers to the kernels in `frac_kernels.h`.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by
+ *  `frac_array.h`. Otherwise `src/frac_array.cpp` compiles it into the
+ *  static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_array.h"
+#include "frac_kernels.h"
+#include <algorithm>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Checks the operand lengths and runs an array-array kernel.
+        template <BatchOp op>
+        std::size_t runArrays(FracArrayView a, FracArrayView b, FracArray& out, FracError* status) {
+            if (a.size() != b.size()) {
+                if (status != nullptr && !a.empty()) status[0] = FracError::SizeMismatch;
+                return 1;
+            }
+            out.resize(a.size());
+            return runBatch<op, false>(a.numerators(), a.denominators(), b.numerators(), b.denominators(),
+                out.numerators(), out.denominators(), a.size(), status);
+        }
+
+        /// @brief Runs an array-scalar kernel.
+        template <BatchOp op>
+        std::size_t runScalar(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status) {
+            // Copied first, `scalar` may refer to an element of `out`
+            const int n2 = scalar.numerator;
+            const int d2 = scalar.denominator;
+            out.resize(a.size());
+            return runBatch<op, true>(a.numerators(), a.denominators(), &n2, &d2,
+                out.numerators(), out.denominators(), a.size(), status);
+        }
+
+        /// @brief Runs the compare kernel of `op`, see `runCompare`.
+        inline std::size_t runCompareOp(FracCompare op, FracArrayView a, const Frac& threshold, std::uint64_t* words) noexcept {
+            // Copied first, `threshold` may refer to an element of `a`
+            const Frac value = threshold;
+            const int* n = a.numerators();
+            const int* d = a.denominators();
+            switch (op) {
+                case FracCompare::Less: return runCompare<CompareOp::Less>(n, d, value, words, a.size());
+                case FracCompare::LessEqual: return runCompare<CompareOp::LessEqual>(n, d, value, words, a.size());
+                case FracCompare::Greater: return runCompare<CompareOp::Greater>(n, d, value, words, a.size());
+                case FracCompare::GreaterEqual: return runCompare<CompareOp::GreaterEqual>(n, d, value, words, a.size());
+                case FracCompare::Equal: return runCompare<CompareOp::Equal>(n, d, value, words, a.size());
+                default: return runCompare<CompareOp::NotEqual>(n, d, value, words, a.size());
+            }
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Masks
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracMask::FracMask(std::pmr::memory_resource* resource) noexcept : wordValues(resource) {}
+
+    FRACLIB_INLINE FracMask::FracMask(size_type count, bool value, std::pmr::memory_resource* resource) :
+        wordValues((count + 63) / 64, value ? ~word_type(0) : 0, resource), bitCount(count) {
+        this->clearTail();
+    }
+
+    FRACLIB_INLINE void FracMask::resize(size_type count) {
+        this->wordValues.resize((count + 63) / 64, 0);
+        this->bitCount = count;
+        this->clearTail();
+    }
+
+    FRACLIB_INLINE void FracMask::set(size_type index, bool value) noexcept {
+        const word_type bit = word_type(1) << (index % 64);
+        if (value) this->wordValues[index / 64] |= bit;
+        else this->wordValues[index / 64] &= ~bit;
+    }
+
+    FRACLIB_INLINE FracMask::size_type FracMask::count() const noexcept {
+        size_type total = 0;
+        for (const word_type word : this->wordValues) total += detail::popcount64(word);
+        return total;
+    }
+
+    FRACLIB_INLINE FracMask& FracMask::operator&=(const FracMask& other) noexcept {
+        for (size_type w = 0; w < this->wordValues.size(); w++) {
+            this->wordValues[w] &= w < other.wordValues.size() ? other.wordValues[w] : 0;
+        }
+        return *this;
+    }
+
+    FRACLIB_INLINE FracMask& FracMask::operator|=(const FracMask& other) noexcept {
+        const size_type shared = std::min(this->wordValues.size(), other.wordValues.size());
+        for (size_type w = 0; w < shared; w++) this->wordValues[w] |= other.wordValues[w];
+        this->clearTail();
+        return *this;
+    }
+
+    FRACLIB_INLINE FracMask& FracMask::flip() noexcept {
+        for (word_type& word : this->wordValues) word = ~word;
+        this->clearTail();
+        return *this;
+    }
+
+    FRACLIB_INLINE void FracMask::clearTail() noexcept {
+        if (this->bitCount % 64 != 0) this->wordValues.back() &= (word_type(1) << (this->bitCount % 64)) - 1;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracArray::FracArray(std::pmr::memory_resource* resource) noexcept : numeratorValues(resource), denominatorValues(resource) {}
+
+    FRACLIB_INLINE FracArray::FracArray(size_type count, std::pmr::memory_resource* resource) :
+        numeratorValues(count, 0, resource), denominatorValues(count, 1, resource) {}
+
+    FRACLIB_INLINE FracArray::FracArray(const Frac* values, size_type count, std::pmr::memory_resource* resource) : FracArray(resource) {
+        reserve(count);
+        for (size_type i = 0; i < count; i++) push_back(values[i]);
+    }
+
+    FRACLIB_INLINE FracArray::FracArray(std::initializer_list<Frac> values, std::pmr::memory_resource* resource) :
+        FracArray(values.begin(), values.size(), resource) {}
+
+    FRACLIB_INLINE FracArray::FracArray(const FracArray& other, std::pmr::memory_resource* resource) :
+        numeratorValues(other.numeratorValues, resource), denominatorValues(other.denominatorValues, resource) {}
+
+    FRACLIB_INLINE FracArray::FracArray(FracArrayView view, std::pmr::memory_resource* resource) :
+        numeratorValues(view.numerators(), view.numerators() + view.size(), resource),
+        denominatorValues(view.denominators(), view.denominators() + view.size(), resource) {}
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Access
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void FracArray::reserve(size_type count) {
+        numeratorValues.reserve(count);
+        denominatorValues.reserve(count);
+    }
+
+    FRACLIB_INLINE void FracArray::resize(size_type count) {
+        numeratorValues.resize(count, 0);
+        denominatorValues.resize(count, 1);
+    }
+
+    FRACLIB_INLINE void FracArray::clear() noexcept {
+        numeratorValues.clear();
+        denominatorValues.clear();
+    }
+
+    FRACLIB_INLINE void FracArray::push_back(const Frac& value) {
+        numeratorValues.push_back(value.numerator);
+        denominatorValues.push_back(value.denominator);
+    }
+
+    FRACLIB_INLINE Frac FracArray::get(size_type index) const noexcept {
+        Frac result;
+        result.numerator = numeratorValues[index];
+        result.denominator = denominatorValues[index];
+        return result;
+    }
+
+    FRACLIB_INLINE void FracArray::set(size_type index, const Frac& value) noexcept {
+        numeratorValues[index] = value.numerator;
+        denominatorValues[index] = value.denominator;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Batch Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracArray::size_type FracArray::add(FracArrayView a, FracArrayView b, FracArray& out, FracError* status) {
+        return detail::runArrays<detail::BatchOp::Add>(a, b, out, status);
+    }
+    FRACLIB_INLINE FracArray::size_type FracArray::add(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status) {
+        return detail::runScalar<detail::BatchOp::Add>(a, scalar, out, status);
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::sub(FracArrayView a, FracArrayView b, FracArray& out, FracError* status) {
+        return detail::runArrays<detail::BatchOp::Sub>(a, b, out, status);
+    }
+    FRACLIB_INLINE FracArray::size_type FracArray::sub(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status) {
+        return detail::runScalar<detail::BatchOp::Sub>(a, scalar, out, status);
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::mul(FracArrayView a, FracArrayView b, FracArray& out, FracError* status) {
+        return detail::runArrays<detail::BatchOp::Mul>(a, b, out, status);
+    }
+    FRACLIB_INLINE FracArray::size_type FracArray::mul(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status) {
+        return detail::runScalar<detail::BatchOp::Mul>(a, scalar, out, status);
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::div(FracArrayView a, FracArrayView b, FracArray& out, FracError* status) {
+        return detail::runArrays<detail::BatchOp::Div>(a, b, out, status);
+    }
+    FRACLIB_INLINE FracArray::size_type FracArray::div(FracArrayView a, const Frac& scalar, FracArray& out, FracError* status) {
+        return detail::runScalar<detail::BatchOp::Div>(a, scalar, out, status);
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::simplifyAll(FracArray& array, FracError* status) {
+        return detail::simplifyBatch(array.numerators(), array.denominators(), array.size(), status);
+    }
+
+    FRACLIB_INLINE const char* FracArray::kernelName() noexcept {
+        return detail::simdLevelName(detail::simdLevel());
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Predicate Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracArray::size_type FracArray::compare(FracArrayView a, FracCompare op, const Frac& threshold, FracMask& out) {
+        out.resize(a.size());
+        return detail::runCompareOp(op, a, threshold, out.words());
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::countIf(FracArrayView a, FracCompare op, const Frac& threshold) noexcept {
+        return detail::runCompareOp(op, a, threshold, nullptr);
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::select(FracArrayView a, const FracMask& mask, FracArray& out) {
+        const size_type count = std::min(a.size(), mask.size());
+        const size_type wordCount = (count + 63) / 64;
+        // Bits past `count` are dropped when `a` is shorter than `mask`
+        const FracMask::word_type lastWord = count % 64 == 0 ? ~FracMask::word_type(0) : (FracMask::word_type(1) << (count % 64)) - 1;
+        const FracMask::word_type* words = mask.words();
+        size_type matches = 0;
+        for (size_type w = 0; w < wordCount; w++) {
+            matches += detail::popcount64(w + 1 == wordCount ? words[w] & lastWord : words[w]);
+        }
+        // Only grows when `out` is not `a`. Otherwise elements move to lower indices and are read before
+        // being overwritten, and the array then shrinks in place.
+        if (out.size() < matches) out.resize(matches);
+        const int* n = a.numerators();
+        const int* d = a.denominators();
+        int* outN = out.numerators();
+        int* outD = out.denominators();
+        size_type j = 0;
+        for (size_type w = 0; w < wordCount; w++) {
+            FracMask::word_type word = w + 1 == wordCount ? words[w] & lastWord : words[w];
+            while (word != 0) {
+                const size_type i = w * 64 + detail::lowestBit64(word);
+                outN[j] = n[i];
+                outD[j] = d[i];
+                j++;
+                word &= word - 1;
+            }
+        }
+        out.resize(matches);
+        return matches;
+    }
+
+    FRACLIB_INLINE FracArray::size_type FracArray::select(FracArrayView a, FracCompare op, const Frac& threshold, FracArray& out) {
+        FracMask mask(out.resource());
+        compare(a, op, threshold, mask);
+        return select(a, mask, out);
+    }
+}
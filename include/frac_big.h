@@ -0,0 +1,218 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_big.h
+ * Description:
+ *  This header file defines `BigFrac`, a fraction with arbitrary-precision
+ *  numerator and denominator that never overflows.
+ *
+ *  Both parts are `BigInt`, so values that fit in 64 bits are stored inline
+ *  with no heap allocation. While every part is inline, operations run on
+ *  `Frac64` (and then `Frac128` if the result does not fit in 64 bits), so
+ *  the common case costs about as much as the fixed-width types. Only a
+ *  result beyond 128 bits falls back to the limb arithmetic of `BigInt`.
+ *
+ *  Like `Frac`, results are in lowest terms with a positive denominator.
+ *  `BigFrac` converts implicitly from integers, decimals, strings and every
+ *  `BasicFrac`, and back with `toFrac` / `tryConvert`.
+ *
+ *  Limbs come from the `std::pmr::memory_resource` of the parts, and results
+ *  from that of the left operand, so a `BigFrac` created with a `FracArena`
+ *  keeps its temporaries in the arena.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_bigint.h"
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+namespace FracLib {
+    /// @brief Fraction with `BigInt` numerator and denominator, always in lowest terms with a positive
+    /// denominator. Arithmetic is exact and only fails on division by zero.
+    class BigFrac {
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Initializes the fraction to `0/1`.
+        BigFrac() noexcept;
+        /// @brief Initializes the fraction to `0/1`, allocating limbs from `resource`.
+        /// @example FracArena arena; BigFrac sum(&arena);
+        explicit BigFrac(std::pmr::memory_resource* resource) noexcept;
+        /// @brief Constructs the whole number `n`.
+        /// @example BigFrac f(5); // 5/1
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        BigFrac(T n, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            numeratorValue(n, resource), denominatorValue(1, resource) {}
+        /// @brief Constructs `n/d` in lowest terms, allocating from the resource of `n`.
+        /// @throws std::invalid_argument if the denominator is zero.
+        /// @example BigFrac f(BigInt::parse("100000000000000000000"), 3);
+        BigFrac(const BigInt& n, const BigInt& d);
+        /// @brief Converts a fraction of any storage width, reducing it.
+        /// @throws std::invalid_argument if the denominator is zero.
+        template <typename IntT>
+        BigFrac(const BasicFrac<IntT>& frac);
+        /// @brief Constructs the exact value of a double (every finite double is a dyadic fraction).
+        /// @throws std::invalid_argument if the decimal is infinite or NaN.
+        /// @example BigFrac f(0.1); // 3602879701896397/36028797018963968
+        BigFrac(double decimal);
+        /// @brief Parses "numerator/denominator", "numerator" or "whole numerator/denominator" of any length.
+        /// @throws std::invalid_argument if the string is not properly formatted or if the denominator is zero.
+        BigFrac(const char* fracStr);
+        BigFrac(const BigFrac& other) = default;
+        BigFrac(BigFrac&& other) noexcept = default;
+
+    public: // OPERATORS
+        // Integers, decimals, strings and `BasicFrac` convert implicitly, so either operand may be one of them.
+        friend BigFrac operator+(const BigFrac& a, const BigFrac& b);
+        friend BigFrac operator-(const BigFrac& a, const BigFrac& b);
+        friend BigFrac operator*(const BigFrac& a, const BigFrac& b);
+        /// @throws std::invalid_argument if `b` is zero.
+        friend BigFrac operator/(const BigFrac& a, const BigFrac& b);
+
+        BigFrac& operator+=(const BigFrac& other) { return *this = *this + other; }
+        BigFrac& operator-=(const BigFrac& other) { return *this = *this - other; }
+        BigFrac& operator*=(const BigFrac& other) { return *this = *this * other; }
+        BigFrac& operator/=(const BigFrac& other) { return *this = *this / other; }
+
+        BigFrac& operator++() { return *this += 1; }
+        BigFrac& operator--() { return *this -= 1; }
+        BigFrac operator++(int) {
+            BigFrac previous = *this;
+            *this += 1;
+            return previous;
+        }
+        BigFrac operator--(int) {
+            BigFrac previous = *this;
+            *this -= 1;
+            return previous;
+        }
+
+        BigFrac operator-() const;
+
+        // Comparision
+        // Values are always reduced, so equality compares the parts.
+        friend bool operator==(const BigFrac& a, const BigFrac& b) noexcept {
+            return a.numeratorValue == b.numeratorValue && a.denominatorValue == b.denominatorValue;
+        }
+        friend bool operator!=(const BigFrac& a, const BigFrac& b) noexcept { return !(a == b); }
+        friend bool operator<(const BigFrac& a, const BigFrac& b) { return compare(a, b) < 0; }
+        friend bool operator<=(const BigFrac& a, const BigFrac& b) { return compare(a, b) <= 0; }
+        friend bool operator>(const BigFrac& a, const BigFrac& b) { return compare(a, b) > 0; }
+        friend bool operator>=(const BigFrac& a, const BigFrac& b) { return compare(a, b) >= 0; }
+
+        // Assignment keeps the resource of the target
+        BigFrac& operator=(const BigFrac& other) = default;
+        BigFrac& operator=(BigFrac&& other) = default;
+
+        // Insertion
+        friend std::ostream& operator<<(std::ostream& os, const BigFrac& frac) { return writeToStream(os, frac); }
+
+    public: // METHODS
+        const BigInt& numerator() const noexcept { return this->numeratorValue; }
+        /// @brief Always positive.
+        const BigInt& denominator() const noexcept { return this->denominatorValue; }
+        /// @brief True when both parts are stored inline (fit in `std::int64_t`).
+        bool isSmall() const noexcept { return this->numeratorValue.isSmall() && this->denominatorValue.isSmall(); }
+        /// @brief Memory resource the limbs are allocated from.
+        std::pmr::memory_resource* resource() const noexcept { return this->numeratorValue.resource(); }
+        /// @brief Converts to a fixed-width fraction if both parts fit in `IntT`.
+        /// @return `Overflow` (leaving `out` unchanged) if they do not.
+        /// @example Frac f; if (big.tryConvert(f) == FracError::None) { ... }
+        template <typename IntT>
+        FracError tryConvert(BasicFrac<IntT>& out) const noexcept;
+        /// @brief Converts to a fixed-width fraction.
+        /// @throws std::overflow_error if a part does not fit in `IntT`.
+        /// @example Frac f = big.toFrac();
+        template <typename IntT = int>
+        BasicFrac<IntT> toFrac() const;
+        /// @brief Hash of the value. Equal to `Frac64::hash` for values whose parts fit in 64 bits.
+        std::size_t hash() const noexcept;
+
+    public: // STATIC METHODS
+        /// @return negative if `a < b`, zero if they are equal and positive if `a > b`.
+        static int compare(const BigFrac& a, const BigFrac& b);
+        /// @brief Converts a fraction to a string (ie. "1/2").
+        static std::string toString(const BigFrac& frac);
+        /// @brief Converts a fraction to the nearest `double`, also when a part is beyond its range.
+        static double toDouble(const BigFrac& frac) noexcept;
+        /// @brief Parses the formats `Frac::parse` accepts, with parts of any length.
+        /// @throws std::invalid_argument if the string is not properly formatted or if the denominator is zero.
+        /// @example BigFrac f = BigFrac::parse("-123456789012345678901234567890/7");
+        static BigFrac parse(std::string_view str);
+
+    public: // NON-THROWING API
+        /// @return `InvalidString` or `ZeroDivisor` on failure, leaving `out` unchanged.
+        static FracError tryParse(std::string_view str, BigFrac& out);
+        /// @return `ZeroDivisor` if `b` is zero, leaving `out` unchanged.
+        static FracError tryDiv(const BigFrac& a, const BigFrac& b, BigFrac& out);
+
+    private: // PRIVATE FUNCTIONS
+        enum class Operation { Add, Subtract, Multiply, Divide };
+
+        /// @brief Takes parts that are already in lowest terms with a positive denominator.
+        BigFrac(BigInt n, BigInt d, bool isReduced) noexcept;
+        /// @brief Runs `op` on `Frac64` (and on `Frac128` if that overflows) when both operands are inline.
+        /// @return false if an operand is in limbs or the result does not fit in the fixed-width types.
+        static bool trySmall(const BigFrac& a, const BigFrac& b, Operation op, BigFrac& out);
+        /// @brief Henrici's addition on `BigInt` parts.
+        static BigFrac addLarge(const BigFrac& a, const BigFrac& b, bool isSubtracting);
+        /// @brief Multiplies `n1/d1` by `n2/d2` after cancelling `gcd(n1, d2)` and `gcd(n2, d1)`.
+        /// `d1` must be positive; the sign of `d2` is moved to the numerator.
+        static BigFrac mulLarge(const BigInt& n1, const BigInt& d1, const BigInt& n2, const BigInt& d2);
+        static std::ostream& writeToStream(std::ostream& os, const BigFrac& frac);
+
+    private: // ATTRIBUTES
+        BigInt numeratorValue;
+        BigInt denominatorValue;
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Inline Definitions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    BigFrac::BigFrac(const BasicFrac<IntT>& frac) : BigFrac(BigInt(frac.numerator), BigInt(frac.denominator)) {}
+
+    template <typename IntT>
+    FracError BigFrac::tryConvert(BasicFrac<IntT>& out) const noexcept {
+        IntT n = 0, d = 1;
+        if (!this->numeratorValue.tryConvert(n) || !this->denominatorValue.tryConvert(d)) {
+            return FracError::Overflow;
+        }
+        out.numerator = n;
+        out.denominator = d;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    BasicFrac<IntT> BigFrac::toFrac() const {
+        BasicFrac<IntT> result;
+        detail::throwOnError(this->tryConvert(result));
+        return result;
+    }
+}
+
+namespace std {
+    /// @brief Hashes big fractions by value (see `BigFrac::hash`).
+    template <>
+    struct hash<FracLib::BigFrac> {
+        std::size_t operator()(const FracLib::BigFrac& frac) const noexcept { return frac.hash(); }
+    };
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_big.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_big_impl.h"
+#endif
@@ -0,0 +1,299 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_big_impl.h
+ * Description:
+ *  Definitions of `BigFrac` declared in frac_big.h: the fixed-width fast
+ *  path, Henrici's addition and cross-cancelled multiplication on `BigInt`
+ *  parts, exact conversion from `double`, and parsing and formatting.
+ *  Included by frac_big.h in header-only mode and compiled once into the
+ *  static library by src/frac_big.cpp otherwise.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_big.h"
+#include <cmath>
+#include <ostream>
+#include <utility>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Computes `2^exponent` by repeated squaring.
+        FRACLIB_INLINE BigInt powerOfTwo(unsigned exponent) {
+            BigInt result = 1, base = 2;
+            for (; exponent != 0; exponent >>= 1) {
+                if (exponent & 1) result *= base;
+                if (exponent > 1) base *= base;
+            }
+            return result;
+        }
+
+        /// @brief Parses the run of digits at `p` into `value` and moves `p` past it.
+        /// @return false if there are no digits at `p`.
+        FRACLIB_INLINE bool parseDigits(std::string_view str, std::size_t& p, BigInt& value) {
+            const std::size_t first = p;
+            while (p < str.size() && str[p] >= '0' && str[p] <= '9') p++;
+            return first != p && BigInt::tryParse(str.substr(first, p - first), value) == FracError::None;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigFrac::BigFrac() noexcept : numeratorValue(), denominatorValue(1) {}
+
+    FRACLIB_INLINE BigFrac::BigFrac(std::pmr::memory_resource* resource) noexcept :
+        numeratorValue(resource), denominatorValue(1, resource) {}
+
+    FRACLIB_INLINE BigFrac::BigFrac(const BigInt& n, const BigInt& d) : numeratorValue(n.resource()), denominatorValue(n.resource()) {
+        if (d.isZero()) {
+            detail::raise(FracError::ZeroDivisor);
+        }
+        // Parts that fit in 64 bits reduce with the native GCD
+        Frac64 small;
+        std::int64_t n64 = 0, d64 = 1;
+        if (n.tryConvert(n64) && d.tryConvert(d64) && Frac64::tryMake(n64, d64, small, true) == FracError::None) {
+            this->numeratorValue = small.numerator;
+            this->denominatorValue = small.denominator;
+            return;
+        }
+
+        const BigInt divisor = BigInt::gcd(n, d);
+        const bool isNegating = d.sign() < 0;
+        this->numeratorValue = isNegating ? -(n / divisor) : n / divisor;
+        this->denominatorValue = isNegating ? -(d / divisor) : d / divisor;
+    }
+
+    FRACLIB_INLINE BigFrac::BigFrac(double decimal) : BigFrac() {
+        if (!std::isfinite(decimal)) {
+            detail::raise(FracError::NotFinite);
+        }
+        if (decimal == 0) return;
+
+        // decimal = mantissa * 2^exponent with a 53-bit integer mantissa
+        int exponent = 0;
+        std::int64_t mantissa = static_cast<std::int64_t>(std::ldexp(std::frexp(decimal, &exponent), 53));
+        exponent -= 53;
+        while ((mantissa & 1) == 0) { // an odd mantissa over a power of two is already reduced
+            mantissa /= 2;
+            exponent++;
+        }
+        if (exponent >= 0) {
+            this->numeratorValue = BigInt(mantissa) * detail::powerOfTwo(static_cast<unsigned>(exponent));
+        } else {
+            this->numeratorValue = mantissa;
+            this->denominatorValue = detail::powerOfTwo(static_cast<unsigned>(-exponent));
+        }
+    }
+
+    FRACLIB_INLINE BigFrac::BigFrac(const char* fracStr) : BigFrac(parse(fracStr)) {}
+
+    FRACLIB_INLINE BigFrac::BigFrac(BigInt n, BigInt d, bool) noexcept : numeratorValue(std::move(n)), denominatorValue(std::move(d)) {}
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigFrac operator+(const BigFrac& a, const BigFrac& b) {
+        BigFrac result(a.resource());
+        if (BigFrac::trySmall(a, b, BigFrac::Operation::Add, result)) return result;
+        return BigFrac::addLarge(a, b, false);
+    }
+
+    FRACLIB_INLINE BigFrac operator-(const BigFrac& a, const BigFrac& b) {
+        BigFrac result(a.resource());
+        if (BigFrac::trySmall(a, b, BigFrac::Operation::Subtract, result)) return result;
+        return BigFrac::addLarge(a, b, true);
+    }
+
+    FRACLIB_INLINE BigFrac operator*(const BigFrac& a, const BigFrac& b) {
+        BigFrac result(a.resource());
+        if (BigFrac::trySmall(a, b, BigFrac::Operation::Multiply, result)) return result;
+        return BigFrac::mulLarge(a.numeratorValue, a.denominatorValue, b.numeratorValue, b.denominatorValue);
+    }
+
+    FRACLIB_INLINE BigFrac operator/(const BigFrac& a, const BigFrac& b) {
+        if (b.numeratorValue.isZero()) {
+            detail::raise(FracError::ZeroDivisor);
+        }
+        BigFrac result(a.resource());
+        if (BigFrac::trySmall(a, b, BigFrac::Operation::Divide, result)) return result;
+        return BigFrac::mulLarge(a.numeratorValue, a.denominatorValue, b.denominatorValue, b.numeratorValue);
+    }
+
+    FRACLIB_INLINE BigFrac BigFrac::operator-() const {
+        return BigFrac(-this->numeratorValue, this->denominatorValue, true);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE std::size_t BigFrac::hash() const noexcept {
+        Frac64 small;
+        if (this->tryConvert(small) == FracError::None) return small.hash();
+        return static_cast<std::size_t>(detail::mixHash(this->numeratorValue.hash() ^ (detail::mixHash(this->denominatorValue.hash()) * 3)));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Static Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE int BigFrac::compare(const BigFrac& a, const BigFrac& b) {
+        Frac64 x, y;
+        if (a.tryConvert(x) == FracError::None && b.tryConvert(y) == FracError::None) return Frac64::compare(x, y);
+
+        // Denominators are positive, so the signs decide unless they are equal
+        const int signA = a.numeratorValue.sign();
+        const int signB = b.numeratorValue.sign();
+        if (signA != signB) return signA < signB ? -1 : 1;
+        return BigInt::compare(a.numeratorValue * b.denominatorValue, b.numeratorValue * a.denominatorValue);
+    }
+
+    FRACLIB_INLINE std::string BigFrac::toString(const BigFrac& frac) {
+        return BigInt::toString(frac.numeratorValue) + "/" + BigInt::toString(frac.denominatorValue);
+    }
+
+    FRACLIB_INLINE double BigFrac::toDouble(const BigFrac& frac) noexcept {
+        return BigInt::toDouble(frac.numeratorValue, frac.denominatorValue);
+    }
+
+    FRACLIB_INLINE BigFrac BigFrac::parse(std::string_view str) {
+        BigFrac result;
+        detail::throwOnError(tryParse(str, result));
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Non-Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracError BigFrac::tryParse(std::string_view str, BigFrac& out) {
+        // Same grammar as `Frac::fromChars`, followed only by whitespace
+        const auto isBlank = [&str](std::size_t i) { return i < str.size() && (str[i] == ' ' || str[i] == '\t'); };
+        std::size_t p = 0;
+        while (isBlank(p)) p++;
+
+        const bool isNegative = p < str.size() && str[p] == '-';
+        if (isNegative) p++;
+        BigInt whole(out.resource()), num(out.resource()), denom(1, out.resource());
+        if (!detail::parseDigits(str, p, num)) return FracError::InvalidString;
+
+        // A blank followed by digits and '/' is a mixed fraction. Otherwise the whole number ends here.
+        bool isMixed = false;
+        if (isBlank(p)) {
+            std::size_t next = p;
+            while (isBlank(next)) next++;
+            BigInt part(out.resource());
+            std::size_t partEnd = next;
+            if (detail::parseDigits(str, partEnd, part) && partEnd < str.size() && str[partEnd] == '/') {
+                isMixed = true;
+                whole = std::move(num);
+                num = std::move(part);
+                p = partEnd;
+            }
+        }
+
+        if (p < str.size() && str[p] == '/') {
+            p++;
+            while (isBlank(p)) p++;
+            if (!detail::parseDigits(str, p, denom)) return FracError::InvalidString;
+            if (denom.isZero()) return FracError::ZeroDivisor;
+        }
+
+        // Only trailing whitespace may follow the fraction
+        for (; p < str.size(); p++) {
+            if (!isBlank(p) && str[p] != '\n' && str[p] != '\r' && str[p] != '\f' && str[p] != '\v') return FracError::InvalidString;
+        }
+
+        BigInt numerator = isMixed ? whole * denom + num : std::move(num);
+        out = BigFrac(isNegative ? -numerator : std::move(numerator), denom);
+        return FracError::None;
+    }
+
+    FRACLIB_INLINE FracError BigFrac::tryDiv(const BigFrac& a, const BigFrac& b, BigFrac& out) {
+        if (b.numeratorValue.isZero()) {
+            return FracError::ZeroDivisor;
+        }
+        out = a / b;
+        return FracError::None;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE bool BigFrac::trySmall(const BigFrac& a, const BigFrac& b, Operation op, BigFrac& out) {
+        const auto apply = [op](const auto& x, const auto& y, auto& result) {
+            using FracT = std::decay_t<decltype(x)>;
+            switch (op) {
+                case Operation::Add: return FracT::tryAdd(x, y, result);
+                case Operation::Subtract: return FracT::trySub(x, y, result);
+                case Operation::Multiply: return FracT::tryMul(x, y, result);
+                default: return FracT::tryDiv(x, y, result);
+            }
+        };
+
+        Frac64 x, y, result;
+        if (a.tryConvert(x) != FracError::None || b.tryConvert(y) != FracError::None) return false;
+        if (apply(x, y, result) == FracError::None) {
+            out = BigFrac(BigInt(result.numerator, a.resource()), BigInt(result.denominator, a.resource()), true);
+            return true;
+        }
+#ifdef FRACLIB_HAS_INT128
+        // Sums and products of 64-bit parts always fit in 128 bits
+        Frac128 wideResult;
+        if (apply(Frac128(x.numerator, x.denominator), Frac128(y.numerator, y.denominator), wideResult) == FracError::None) {
+            out = BigFrac(BigInt(wideResult.numerator, a.resource()), BigInt(wideResult.denominator, a.resource()), true);
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    FRACLIB_INLINE BigFrac BigFrac::addLarge(const BigFrac& a, const BigFrac& b, bool isSubtracting) {
+        const BigInt& n1 = a.numeratorValue;
+        const BigInt& d1 = a.denominatorValue;
+        const BigInt n2 = isSubtracting ? -b.numeratorValue : b.numeratorValue;
+        const BigInt& d2 = b.denominatorValue;
+
+        // Henrici: only the common factor of the denominators can divide the sum.
+        // Every product starts with a part of `a`, so the result uses its resource.
+        const BigInt divisor = BigInt::gcd(d1, d2);
+        if (divisor == 1) return BigFrac(n1 * d2 + d1 * n2, d1 * d2, true);
+        const BigInt s = d1 / divisor;
+        const BigInt t = d2 / divisor;
+        BigInt n = n1 * t + s * n2;
+        if (n.isZero()) return BigFrac(a.resource());
+        const BigInt common = BigInt::gcd(n, divisor);
+        return BigFrac(n / common, s * (d2 / common), true);
+    }
+
+    FRACLIB_INLINE BigFrac BigFrac::mulLarge(const BigInt& n1, const BigInt& d1, const BigInt& n2, const BigInt& d2) {
+        if (n1.isZero() || n2.isZero()) return BigFrac(n1.resource());
+        // Both inputs are reduced, so cancelling across them leaves the product reduced
+        const BigInt g1 = BigInt::gcd(n1, d2);
+        const BigInt g2 = BigInt::gcd(n2, d1);
+        BigInt n = (n1 / g1) * (n2 / g2);
+        BigInt d = (d1 / g2) * (d2 / g1);
+        if (d.sign() < 0) return BigFrac(-n, -d, true);
+        return BigFrac(std::move(n), std::move(d), true);
+    }
+
+    FRACLIB_INLINE std::ostream& BigFrac::writeToStream(std::ostream& os, const BigFrac& frac) {
+        return os << toString(frac);
+    }
+}
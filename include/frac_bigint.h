@@ -0,0 +1,270 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_bigint.h
+ * Description:
+ *  This header file defines `BigInt`, the arbitrary-precision signed integer
+ *  behind `BigFrac`.
+ *
+ *  Values that fit in `std::int64_t` are stored inline and computed with
+ *  native instructions and the overflow checks of `frac_overflow.h`, with no
+ *  heap allocation. Only a result that does not fit spills to a heap buffer
+ *  of 32-bit limbs, and a large result that fits again returns to the inline
+ *  form. The small paths are inline in this header; the limb arithmetic
+ *  (schoolbook multiplication and Knuth's long division) lives in
+ *  `frac_bigint_impl.h`.
+ *
+ *  Limbs are allocated from a `std::pmr::memory_resource` (the default
+ *  resource unless one is given). Copies and arithmetic results use the
+ *  resource of their source, or of the left operand, so the temporaries of
+ *  a computation on arena-backed values stay in the arena (see
+ *  `frac_memory.h`).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_overflow.h"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Read-only magnitude, least significant limb first, without leading zero limbs.
+        struct LimbSpan {
+            const std::uint32_t* data;
+            std::size_t size;
+        };
+    }
+
+    /// @brief Arbitrary-precision signed integer with an inline `std::int64_t` fast path.
+    /// Division truncates toward zero and `%` takes the sign of the dividend, as for built-in integers.
+    /// Results are allocated from the memory resource of the left operand.
+    class BigInt {
+    public: // TYPES
+        using limb_type = std::uint32_t;
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Initializes the value to `0`.
+        BigInt() noexcept : smallValue(0), isNegativeLarge(false) {}
+        /// @brief Initializes the value to `0`, allocating limbs from `resource`.
+        /// @example FracArena arena; BigInt big(&arena);
+        explicit BigInt(std::pmr::memory_resource* resource) noexcept : smallValue(0), limbs(resource), isNegativeLarge(false) {}
+        /// @brief Constructs from any built-in integer, including 128-bit ones.
+        /// Values outside the `std::int64_t` range are stored in limbs allocated from `resource`.
+        /// @example BigInt big = std::numeric_limits<std::uint64_t>::max();
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        BigInt(T value, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        /// @brief Copies `other`, allocating from the same resource.
+        BigInt(const BigInt& other) : smallValue(other.smallValue), limbs(other.limbs, other.limbs.get_allocator()), isNegativeLarge(other.isNegativeLarge) {}
+        /// @brief Copies `other`, allocating from `resource`.
+        BigInt(const BigInt& other, std::pmr::memory_resource* resource) :
+            smallValue(other.smallValue), limbs(other.limbs, resource), isNegativeLarge(other.isNegativeLarge) {}
+        BigInt(BigInt&& other) noexcept = default;
+
+    public: // OPERATORS
+        // Basic Arithmetic
+        friend BigInt operator+(const BigInt& a, const BigInt& b) {
+            std::int64_t result = 0;
+            if (a.isSmall() && b.isSmall() && !detail::addOverflow(a.smallValue, b.smallValue, result)) return BigInt(result, a.resource());
+            return addLarge(a, b, false);
+        }
+        friend BigInt operator-(const BigInt& a, const BigInt& b) {
+            std::int64_t result = 0;
+            if (a.isSmall() && b.isSmall() && !detail::subOverflow(a.smallValue, b.smallValue, result)) return BigInt(result, a.resource());
+            return addLarge(a, b, true);
+        }
+        friend BigInt operator*(const BigInt& a, const BigInt& b) {
+            std::int64_t result = 0;
+            if (a.isSmall() && b.isSmall() && !detail::mulOverflow(a.smallValue, b.smallValue, result)) return BigInt(result, a.resource());
+            return mulLarge(a, b);
+        }
+        /// @throws std::invalid_argument if `b` is zero.
+        friend BigInt operator/(const BigInt& a, const BigInt& b) {
+            BigInt quotient(a.resource()), remainder(a.resource());
+            divMod(a, b, quotient, remainder);
+            return quotient;
+        }
+        /// @throws std::invalid_argument if `b` is zero.
+        friend BigInt operator%(const BigInt& a, const BigInt& b) {
+            BigInt quotient(a.resource()), remainder(a.resource());
+            divMod(a, b, quotient, remainder);
+            return remainder;
+        }
+
+        // Compound
+        BigInt& operator+=(const BigInt& other) { return *this = *this + other; }
+        BigInt& operator-=(const BigInt& other) { return *this = *this - other; }
+        BigInt& operator*=(const BigInt& other) { return *this = *this * other; }
+        BigInt& operator/=(const BigInt& other) { return *this = *this / other; }
+        BigInt& operator%=(const BigInt& other) { return *this = *this % other; }
+
+        // Unary
+        BigInt operator-() const;
+
+        // Comparision
+        friend bool operator==(const BigInt& a, const BigInt& b) noexcept {
+            if (a.isSmall() || b.isSmall()) return a.isSmall() && b.isSmall() && a.smallValue == b.smallValue;
+            return a.isNegativeLarge == b.isNegativeLarge && a.limbs == b.limbs;
+        }
+        friend bool operator!=(const BigInt& a, const BigInt& b) noexcept { return !(a == b); }
+        friend bool operator<(const BigInt& a, const BigInt& b) noexcept { return compare(a, b) < 0; }
+        friend bool operator<=(const BigInt& a, const BigInt& b) noexcept { return compare(a, b) <= 0; }
+        friend bool operator>(const BigInt& a, const BigInt& b) noexcept { return compare(a, b) > 0; }
+        friend bool operator>=(const BigInt& a, const BigInt& b) noexcept { return compare(a, b) >= 0; }
+
+        // Assignment keeps the resource of the target
+        BigInt& operator=(const BigInt& other) = default;
+        BigInt& operator=(BigInt&& other) = default;
+
+        // Insertion
+        friend std::ostream& operator<<(std::ostream& os, const BigInt& value) { return writeToStream(os, value); }
+
+    public: // METHODS
+        /// @brief True when the value is stored inline, ie. it fits in `std::int64_t`.
+        bool isSmall() const noexcept { return this->limbs.empty(); }
+        bool isZero() const noexcept { return this->isSmall() && this->smallValue == 0; }
+        /// @brief -1, 0 or 1 for the sign of the value.
+        int sign() const noexcept {
+            if (this->isSmall()) return detail::signOf(this->smallValue);
+            return this->isNegativeLarge ? -1 : 1;
+        }
+        /// @brief Number of 32-bit limbs of the magnitude, `0` for inline values.
+        std::size_t limbCount() const noexcept { return this->limbs.size(); }
+        /// @brief Memory resource the limbs are allocated from.
+        std::pmr::memory_resource* resource() const noexcept { return this->limbs.get_allocator().resource(); }
+        /// @brief Converts to `T` (`int`, `std::int64_t` or `__int128`) if the value fits.
+        /// @return false (leaving `out` unchanged) if it does not.
+        /// @example std::int64_t n; if (big.tryConvert(n)) { ... }
+        template <typename T>
+        bool tryConvert(T& out) const noexcept;
+        /// @brief Hash of the value, equal for equal values.
+        std::size_t hash() const noexcept;
+
+    public: // STATIC METHODS
+        /// @return negative if `a < b`, zero if they are equal and positive if `a > b`.
+        static int compare(const BigInt& a, const BigInt& b) noexcept {
+            if (a.isSmall() && b.isSmall()) return (a.smallValue > b.smallValue) - (a.smallValue < b.smallValue);
+            return compareLarge(a, b);
+        }
+        /// @brief Computes the truncated quotient and the remainder of `a / b`.
+        /// `quotient` and `remainder` may alias `a` or `b`.
+        /// @throws std::invalid_argument if `b` is zero.
+        static void divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+        /// @brief Greatest common divisor of the magnitudes, `gcd(0, 0)` being `0`.
+        static BigInt gcd(const BigInt& a, const BigInt& b);
+        static BigInt abs(const BigInt& value);
+        /// @brief Decimal representation, with a leading '-' for negative values.
+        static std::string toString(const BigInt& value);
+        /// @brief Converts to `double`, infinity if the magnitude is beyond its range.
+        static double toDouble(const BigInt& value) noexcept;
+        /// @brief Computes `numerator / denominator` as a `double` without converting either operand on its
+        /// own, so the ratio of two values beyond the range of `double` is still finite.
+        static double toDouble(const BigInt& numerator, const BigInt& denominator) noexcept;
+        /// @brief Parses a decimal integer with an optional leading '-' or '+'. Surrounding whitespace is ignored.
+        /// @throws std::invalid_argument if the text is not an integer.
+        /// @example BigInt big = BigInt::parse("123456789012345678901234567890");
+        static BigInt parse(std::string_view str);
+        /// @brief Non-throwing form of `parse`.
+        /// @return `InvalidString` if the text is not an integer.
+        static FracError tryParse(std::string_view str, BigInt& out);
+
+    private: // PRIVATE FUNCTIONS
+        /// @brief Adds or subtracts when an operand is in limbs or the inline result overflowed.
+        static BigInt addLarge(const BigInt& a, const BigInt& b, bool isSubtracting);
+        /// @brief Multiplies when an operand is in limbs or the inline result overflowed.
+        static BigInt mulLarge(const BigInt& a, const BigInt& b);
+        static int compareLarge(const BigInt& a, const BigInt& b) noexcept;
+        /// @brief Builds a value from a magnitude, returning to the inline form if it fits.
+        /// The result uses the resource of `magnitude`.
+        static BigInt fromMagnitude(std::pmr::vector<limb_type>&& magnitude, bool isNegative);
+        static std::ostream& writeToStream(std::ostream& os, const BigInt& value);
+        /// @brief Magnitude of the value. Inline values are written to `buffer`.
+        detail::LimbSpan magnitude(limb_type (&buffer)[2]) const noexcept;
+
+    private: // ATTRIBUTES
+        std::int64_t smallValue;           // the value while `limbs` is empty
+        std::pmr::vector<limb_type> limbs; // magnitude, least significant limb first, only for values beyond `std::int64_t`
+        bool isNegativeLarge;              // sign of a value stored in `limbs`
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Inline Definitions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename T, typename>
+    BigInt::BigInt(T value, std::pmr::memory_resource* resource) : smallValue(0), limbs(resource), isNegativeLarge(false) {
+        if (detail::fitsIn<std::int64_t>(value)) {
+            this->smallValue = static_cast<std::int64_t>(value);
+            return;
+        }
+        // Only unsigned 64-bit and 128-bit values get here
+        if constexpr (sizeof(T) >= sizeof(std::int64_t)) {
+            if constexpr (static_cast<T>(-1) < static_cast<T>(0)) {
+                this->isNegativeLarge = value < 0;
+                auto magnitude = detail::absToUnsigned(value);
+                while (magnitude != 0) {
+                    this->limbs.push_back(static_cast<limb_type>(magnitude));
+                    magnitude >>= 32;
+                }
+            } else {
+                while (value != 0) {
+                    this->limbs.push_back(static_cast<limb_type>(value));
+                    value >>= 32;
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    bool BigInt::tryConvert(T& out) const noexcept {
+        if (this->isSmall()) {
+            if (!detail::fitsIn<T>(this->smallValue)) return false;
+            out = static_cast<T>(this->smallValue);
+            return true;
+        }
+        // Limbs only hold values beyond `std::int64_t`, so only 128-bit types can take them
+        if constexpr (sizeof(T) > sizeof(std::int64_t)) {
+            if (this->limbs.size() > sizeof(T) / sizeof(limb_type)) return false;
+            using Unsigned = typename detail::IntTraits<T>::Unsigned;
+            Unsigned magnitude = 0;
+            for (std::size_t i = this->limbs.size(); i-- > 0;) magnitude = (magnitude << 32) | this->limbs[i];
+            const Unsigned limit = static_cast<Unsigned>(detail::IntTraits<T>::max);
+            if (this->isNegativeLarge) {
+                if (magnitude > limit + 1) return false;
+                out = static_cast<T>(static_cast<Unsigned>(0) - magnitude);
+            } else {
+                if (magnitude > limit) return false;
+                out = static_cast<T>(magnitude);
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
+}
+
+namespace std {
+    template <>
+    struct hash<FracLib::BigInt> {
+        std::size_t operator()(const FracLib::BigInt& value) const noexcept { return value.hash(); }
+    };
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_bigint.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_bigint_impl.h"
+#endif
@@ -0,0 +1,415 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_bigint_impl.h
+ * Description:
+ *  Definitions of the `BigInt` limb arithmetic declared in frac_bigint.h:
+ *  magnitude addition, subtraction and schoolbook multiplication, Knuth's
+ *  long division (Algorithm D), Euclid's GCD, and decimal conversions.
+ *  Included by frac_bigint.h in header-only mode and compiled once into the
+ *  static library by src/frac_bigint.cpp otherwise.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_bigint.h"
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        using Limb = BigInt::limb_type;
+        using Limbs = std::pmr::vector<Limb>;
+
+        /// @brief Number of leading zero bits of a non-zero limb.
+        FRACLIB_INLINE int countLeadingZeros(Limb value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_clz(value);
+#else
+            int count = 0;
+            while ((value & 0x80000000u) == 0) {
+                value <<= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        /// @brief Drops leading zero limbs.
+        FRACLIB_INLINE void trimLimbs(Limbs& limbs) noexcept {
+            while (!limbs.empty() && limbs.back() == 0) limbs.pop_back();
+        }
+
+        FRACLIB_INLINE int compareMagnitude(LimbSpan a, LimbSpan b) noexcept {
+            if (a.size != b.size) return a.size < b.size ? -1 : 1;
+            for (std::size_t i = a.size; i-- > 0;) {
+                if (a.data[i] != b.data[i]) return a.data[i] < b.data[i] ? -1 : 1;
+            }
+            return 0;
+        }
+
+        FRACLIB_INLINE Limbs addMagnitude(LimbSpan a, LimbSpan b, std::pmr::memory_resource* resource) {
+            if (a.size < b.size) std::swap(a, b);
+            Limbs sum(a.size + 1, 0, resource);
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < a.size; i++) {
+                carry += static_cast<std::uint64_t>(a.data[i]) + (i < b.size ? b.data[i] : 0);
+                sum[i] = static_cast<Limb>(carry);
+                carry >>= 32;
+            }
+            sum[a.size] = static_cast<Limb>(carry);
+            trimLimbs(sum);
+            return sum;
+        }
+
+        /// @brief Computes `a - b` for `a >= b`.
+        FRACLIB_INLINE Limbs subMagnitude(LimbSpan a, LimbSpan b, std::pmr::memory_resource* resource) {
+            Limbs difference(a.size, 0, resource);
+            std::uint64_t borrow = 0;
+            for (std::size_t i = 0; i < a.size; i++) {
+                const std::uint64_t subtrahend = (i < b.size ? b.data[i] : 0) + borrow;
+                difference[i] = static_cast<Limb>(a.data[i] - subtrahend);
+                borrow = a.data[i] < subtrahend ? 1 : 0;
+            }
+            trimLimbs(difference);
+            return difference;
+        }
+
+        FRACLIB_INLINE Limbs mulMagnitude(LimbSpan a, LimbSpan b, std::pmr::memory_resource* resource) {
+            Limbs product(a.size + b.size, 0, resource);
+            for (std::size_t i = 0; i < a.size; i++) {
+                std::uint64_t carry = 0;
+                for (std::size_t j = 0; j < b.size; j++) {
+                    carry += static_cast<std::uint64_t>(a.data[i]) * b.data[j] + product[i + j];
+                    product[i + j] = static_cast<Limb>(carry);
+                    carry >>= 32;
+                }
+                product[i + b.size] = static_cast<Limb>(carry);
+            }
+            trimLimbs(product);
+            return product;
+        }
+
+        /// @brief Divides `value` in place by a single limb.
+        /// @return the remainder.
+        FRACLIB_INLINE Limb divideByLimb(Limbs& value, Limb divisor) noexcept {
+            std::uint64_t remainder = 0;
+            for (std::size_t i = value.size(); i-- > 0;) {
+                const std::uint64_t current = (remainder << 32) | value[i];
+                value[i] = static_cast<Limb>(current / divisor);
+                remainder = current % divisor;
+            }
+            trimLimbs(value);
+            return static_cast<Limb>(remainder);
+        }
+
+        /// @brief Long division of magnitudes (Knuth, TAOCP vol. 2, 4.3.1 Algorithm D) for `a >= b > 0`.
+        /// The divisor is shifted so its top bit is set, which keeps each estimated quotient limb
+        /// at most two above the true one. The working copies use the resource of `quotient`.
+        FRACLIB_INLINE void divModMagnitude(LimbSpan a, LimbSpan b, Limbs& quotient, Limbs& remainder) {
+            if (b.size == 1) {
+                quotient.assign(a.data, a.data + a.size);
+                const Limb rest = divideByLimb(quotient, b.data[0]);
+                remainder.assign(rest != 0 ? 1 : 0, rest);
+                return;
+            }
+
+            const std::size_t n = b.size;
+            const std::size_t m = a.size - n;
+            const int shift = countLeadingZeros(b.data[n - 1]);
+            const auto shifted = [shift](const Limb* data, std::size_t i) {
+                const Limb low = (shift != 0 && i > 0) ? static_cast<Limb>(data[i - 1] >> (32 - shift)) : 0;
+                return static_cast<Limb>((data[i] << shift) | low);
+            };
+            std::pmr::memory_resource* resource = quotient.get_allocator().resource();
+            Limbs divisor(n, 0, resource), dividend(a.size + 1, 0, resource);
+            for (std::size_t i = 0; i < n; i++) divisor[i] = shifted(b.data, i);
+            for (std::size_t i = 0; i < a.size; i++) dividend[i] = shifted(a.data, i);
+            dividend[a.size] = shift != 0 ? static_cast<Limb>(a.data[a.size - 1] >> (32 - shift)) : 0;
+
+            constexpr std::uint64_t BASE = std::uint64_t(1) << 32;
+            quotient.assign(m + 1, 0);
+            for (std::size_t j = m + 1; j-- > 0;) {
+                // Estimate from the top two limbs, then correct with the third
+                const std::uint64_t top = (static_cast<std::uint64_t>(dividend[j + n]) << 32) | dividend[j + n - 1];
+                std::uint64_t estimate = top / divisor[n - 1];
+                std::uint64_t rest = top % divisor[n - 1];
+                while (estimate >= BASE || estimate * divisor[n - 2] > ((rest << 32) | dividend[j + n - 2])) {
+                    estimate--;
+                    rest += divisor[n - 1];
+                    if (rest >= BASE) break;
+                }
+
+                // Multiply and subtract
+                std::int64_t borrow = 0;
+                std::int64_t difference = 0;
+                for (std::size_t i = 0; i < n; i++) {
+                    const std::uint64_t product = estimate * divisor[i];
+                    difference = static_cast<std::int64_t>(dividend[i + j]) - borrow - static_cast<std::int64_t>(product & 0xFFFFFFFFu);
+                    dividend[i + j] = static_cast<Limb>(difference);
+                    borrow = static_cast<std::int64_t>(product >> 32) - (difference >> 32);
+                }
+                difference = static_cast<std::int64_t>(dividend[j + n]) - borrow;
+                dividend[j + n] = static_cast<Limb>(difference);
+
+                // The estimate was one too large, add the divisor back
+                if (difference < 0) {
+                    estimate--;
+                    std::uint64_t carry = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                        carry += static_cast<std::uint64_t>(dividend[i + j]) + divisor[i];
+                        dividend[i + j] = static_cast<Limb>(carry);
+                        carry >>= 32;
+                    }
+                    dividend[j + n] = static_cast<Limb>(dividend[j + n] + carry);
+                }
+                quotient[j] = static_cast<Limb>(estimate);
+            }
+
+            remainder.resize(n);
+            for (std::size_t i = 0; i < n; i++) {
+                const Limb high = shift != 0 ? static_cast<Limb>(dividend[i + 1] << (32 - shift)) : 0;
+                remainder[i] = static_cast<Limb>((dividend[i] >> shift) | high);
+            }
+            trimLimbs(quotient);
+            trimLimbs(remainder);
+        }
+
+        FRACLIB_INLINE bool isSpace(char ch) noexcept {
+            return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f' || ch == '\v';
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigInt BigInt::operator-() const {
+        if (this->isSmall() && this->smallValue != detail::IntTraits<std::int64_t>::min) return BigInt(-this->smallValue, this->resource());
+        limb_type buffer[2];
+        const detail::LimbSpan value = this->magnitude(buffer);
+        return fromMagnitude(detail::Limbs(value.data, value.data + value.size, this->resource()), this->sign() > 0);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE std::size_t BigInt::hash() const noexcept {
+        if (this->isSmall()) return static_cast<std::size_t>(detail::mixHash(static_cast<std::uint64_t>(this->smallValue)));
+        std::uint64_t result = this->isNegativeLarge ? ~std::uint64_t(0) : 0;
+        for (limb_type limb : this->limbs) result = detail::mixHash(result ^ limb);
+        return static_cast<std::size_t>(result);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Static Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void BigInt::divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder) {
+        if (b.isZero()) {
+            detail::raise(FracError::ZeroDivisor);
+        }
+        // The one inline quotient that does not fit is the minimum over -1
+        if (a.isSmall() && b.isSmall() && !(a.smallValue == detail::IntTraits<std::int64_t>::min && b.smallValue == -1)) {
+            const std::int64_t q = a.smallValue / b.smallValue;
+            const std::int64_t r = a.smallValue % b.smallValue;
+            quotient = BigInt(q, quotient.resource());
+            remainder = BigInt(r, remainder.resource());
+            return;
+        }
+
+        limb_type bufferA[2], bufferB[2];
+        const detail::LimbSpan x = a.magnitude(bufferA);
+        const detail::LimbSpan y = b.magnitude(bufferB);
+        if (detail::compareMagnitude(x, y) < 0) {
+            BigInt rest = a;
+            quotient = BigInt(quotient.resource());
+            remainder = std::move(rest);
+            return;
+        }
+        detail::Limbs q(quotient.resource()), r(remainder.resource());
+        detail::divModMagnitude(x, y, q, r);
+        BigInt q2 = fromMagnitude(std::move(q), (a.sign() < 0) != (b.sign() < 0));
+        BigInt r2 = fromMagnitude(std::move(r), a.sign() < 0);
+        quotient = std::move(q2);
+        remainder = std::move(r2);
+    }
+
+    FRACLIB_INLINE BigInt BigInt::gcd(const BigInt& a, const BigInt& b) {
+        BigInt x = abs(a), y(abs(b), a.resource());
+        BigInt quotient(a.resource()), rest(a.resource());
+        while (!y.isZero()) {
+            // Euclid shrinks the operands until both are inline, then the binary GCD finishes
+            if (x.isSmall() && y.isSmall()) {
+                return BigInt(detail::gcd(static_cast<std::uint64_t>(x.smallValue), static_cast<std::uint64_t>(y.smallValue)), a.resource());
+            }
+            divMod(x, y, quotient, rest);
+            x = std::move(y);
+            y = std::move(rest);
+        }
+        return x;
+    }
+
+    FRACLIB_INLINE BigInt BigInt::abs(const BigInt& value) {
+        return value.sign() < 0 ? -value : value;
+    }
+
+    FRACLIB_INLINE std::string BigInt::toString(const BigInt& value) {
+        if (value.isSmall()) return std::to_string(static_cast<long long>(value.smallValue));
+
+        // Nine decimal digits at a time, least significant group first
+        detail::Limbs rest(value.limbs, value.resource());
+        std::vector<limb_type> groups;
+        while (!rest.empty()) groups.push_back(detail::divideByLimb(rest, 1000000000u));
+
+        std::string result = value.isNegativeLarge ? "-" : "";
+        result += std::to_string(groups.back());
+        for (std::size_t i = groups.size() - 1; i-- > 0;) {
+            const std::string group = std::to_string(groups[i]);
+            result.append(9 - group.size(), '0');
+            result += group;
+        }
+        return result;
+    }
+
+    FRACLIB_INLINE double BigInt::toDouble(const BigInt& value) noexcept {
+        if (value.isSmall()) return static_cast<double>(value.smallValue);
+        double result = 0;
+        for (std::size_t i = value.limbs.size(); i-- > 0;) result = result * 4294967296.0 + value.limbs[i];
+        return value.isNegativeLarge ? -result : result;
+    }
+
+    FRACLIB_INLINE double BigInt::toDouble(const BigInt& numerator, const BigInt& denominator) noexcept {
+        if (numerator.isSmall() && denominator.isSmall()) return toDouble(numerator) / toDouble(denominator);
+
+        // Each operand keeps only its own top limbs, far more bits than a double holds, and the
+        // limbs it dropped are applied to the quotient as a power of two
+        constexpr std::size_t KEPT_LIMBS = 8;
+        const auto scaled = [](const BigInt& value, int& exponent) {
+            limb_type buffer[2];
+            const detail::LimbSpan digits = value.magnitude(buffer);
+            const std::size_t dropped = digits.size > KEPT_LIMBS ? digits.size - KEPT_LIMBS : 0;
+            exponent = static_cast<int>(dropped * 32);
+            double result = 0;
+            for (std::size_t i = digits.size; i-- > dropped;) result = result * 4294967296.0 + digits.data[i];
+            return value.sign() < 0 ? -result : result;
+        };
+        int numeratorExponent = 0, denominatorExponent = 0;
+        const double quotient = scaled(numerator, numeratorExponent) / scaled(denominator, denominatorExponent);
+        return std::ldexp(quotient, numeratorExponent - denominatorExponent);
+    }
+
+    FRACLIB_INLINE BigInt BigInt::parse(std::string_view str) {
+        BigInt result;
+        detail::throwOnError(tryParse(str, result));
+        return result;
+    }
+
+    FRACLIB_INLINE FracError BigInt::tryParse(std::string_view str, BigInt& out) {
+        std::size_t first = 0, last = str.size();
+        while (first < last && detail::isSpace(str[first])) first++;
+        while (last > first && detail::isSpace(str[last - 1])) last--;
+
+        const bool isNegative = first < last && str[first] == '-';
+        if (first < last && (str[first] == '-' || str[first] == '+')) first++;
+        if (first == last) return FracError::InvalidString;
+        for (std::size_t i = first; i < last; i++) {
+            if (str[i] < '0' || str[i] > '9') return FracError::InvalidString;
+        }
+
+        // Nine digits at a time, the first group taking what is left over
+        std::int64_t group = 0;
+        std::size_t digits = (last - first) % 9;
+        if (digits == 0) digits = 9;
+        BigInt result(out.resource());
+        for (std::size_t i = first; i < last;) {
+            group = 0;
+            for (std::size_t end = i + digits; i < end; i++) group = group * 10 + (str[i] - '0');
+            result = result * BigInt(static_cast<std::int64_t>(1000000000)) + BigInt(group);
+            digits = 9;
+        }
+        out = isNegative ? -result : std::move(result);
+        return FracError::None;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigInt BigInt::addLarge(const BigInt& a, const BigInt& b, bool isSubtracting) {
+        limb_type bufferA[2], bufferB[2];
+        const detail::LimbSpan x = a.magnitude(bufferA);
+        const detail::LimbSpan y = b.magnitude(bufferB);
+        const bool isNegativeA = a.sign() < 0;
+        const bool isNegativeB = (b.sign() < 0) != isSubtracting;
+        if (isNegativeA == isNegativeB) return fromMagnitude(detail::addMagnitude(x, y, a.resource()), isNegativeA);
+
+        // Opposite signs: the larger magnitude decides the sign
+        const int order = detail::compareMagnitude(x, y);
+        if (order == 0) return BigInt(a.resource());
+        if (order > 0) return fromMagnitude(detail::subMagnitude(x, y, a.resource()), isNegativeA);
+        return fromMagnitude(detail::subMagnitude(y, x, a.resource()), isNegativeB);
+    }
+
+    FRACLIB_INLINE BigInt BigInt::mulLarge(const BigInt& a, const BigInt& b) {
+        if (a.isZero() || b.isZero()) return BigInt(a.resource());
+        limb_type bufferA[2], bufferB[2];
+        return fromMagnitude(detail::mulMagnitude(a.magnitude(bufferA), b.magnitude(bufferB), a.resource()), (a.sign() < 0) != (b.sign() < 0));
+    }
+
+    FRACLIB_INLINE int BigInt::compareLarge(const BigInt& a, const BigInt& b) noexcept {
+        const int signA = a.sign();
+        const int signB = b.sign();
+        if (signA != signB) return signA < signB ? -1 : 1;
+        limb_type bufferA[2], bufferB[2];
+        const int order = detail::compareMagnitude(a.magnitude(bufferA), b.magnitude(bufferB));
+        return signA > 0 ? order : -order;
+    }
+
+    FRACLIB_INLINE BigInt BigInt::fromMagnitude(std::pmr::vector<limb_type>&& magnitude, bool isNegative) {
+        detail::trimLimbs(magnitude);
+        BigInt result(magnitude.get_allocator().resource());
+        if (magnitude.size() <= 2) {
+            std::uint64_t value = 0;
+            if (!magnitude.empty()) value = magnitude[0];
+            if (magnitude.size() == 2) value |= static_cast<std::uint64_t>(magnitude[1]) << 32;
+            constexpr std::uint64_t LIMIT = static_cast<std::uint64_t>(detail::IntTraits<std::int64_t>::max);
+            if (value <= LIMIT) {
+                result.smallValue = isNegative ? -static_cast<std::int64_t>(value) : static_cast<std::int64_t>(value);
+                return result;
+            }
+            if (isNegative && value == LIMIT + 1) {
+                result.smallValue = detail::IntTraits<std::int64_t>::min;
+                return result;
+            }
+        }
+        result.limbs = std::move(magnitude);
+        result.isNegativeLarge = isNegative;
+        return result;
+    }
+
+    FRACLIB_INLINE std::ostream& BigInt::writeToStream(std::ostream& os, const BigInt& value) {
+        return os << toString(value);
+    }
+
+    FRACLIB_INLINE detail::LimbSpan BigInt::magnitude(limb_type (&buffer)[2]) const noexcept {
+        if (!this->isSmall()) return detail::LimbSpan{this->limbs.data(), this->limbs.size()};
+        const std::uint64_t value = detail::absToUnsigned(this->smallValue);
+        buffer[0] = static_cast<limb_type>(value);
+        buffer[1] = static_cast<limb_type>(value >> 32);
+        return detail::LimbSpan{buffer, buffer[1] != 0 ? std::size_t(2) : (buffer[0] != 0 ? std::size_t(1) : std::size_t(0))};
+    }
+}
@@ -0,0 +1,296 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_binary.h
+ * Description:
+ *  This header file defines a versioned binary format for fractions,
+ *  `writeBinary` / `readBinary` for `BasicFrac` arrays and `FracArray`, and
+ *  `MappedFracArray`, which memory-maps a file as a zero-copy `FracArrayView`.
+ *
+ *  A file is a 32-byte header followed by two columns of fixed-width
+ *  little-endian two's complement integers, all numerators and then all
+ *  denominators:
+ *
+ *      offset  size  field
+ *      0       4     magic "FRAC"
+ *      4       2     version (FRAC_BINARY_VERSION)
+ *      6       1     integer width in bytes (4, 8 or 16)
+ *      7       1     flags, bit 0: every fraction is canonical
+ *      8       8     number of fractions
+ *      16      16    reserved, zero
+ *      32            numerators, then denominators
+ *
+ *  Readers convert between widths and report `Overflow` for values that do
+ *  not fit. Files of 32-bit integers map directly onto a `FracArrayView` on
+ *  little-endian hosts, so opening them costs no parsing or copying.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_array.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace FracLib {
+    /// @brief Version written by `writeBinary`; readers accept files up to this version.
+    constexpr std::uint16_t FRAC_BINARY_VERSION = 1;
+    /// @brief Size of the file header, the offset of the numerator column.
+    constexpr std::size_t FRAC_BINARY_HEADER_SIZE = 32;
+
+    /// @brief Header fields of a binary fraction file.
+    struct FracBinaryInfo {
+        std::uint16_t version;  ///< Format version of the file.
+        std::uint8_t width;     ///< Bytes per integer (4, 8 or 16).
+        bool isCanonical;       ///< Every fraction is in lowest terms with a positive denominator.
+        std::uint64_t count;    ///< Number of fractions.
+    };
+
+    namespace detail {
+        constexpr std::size_t BINARY_CHUNK = 1024; // values encoded or decoded per stream call
+        constexpr std::uint8_t BINARY_CANONICAL_FLAG = 1;
+
+#ifdef FRACLIB_HAS_INT128
+        using BinaryInt = __int128;
+#else
+        using BinaryInt = std::int64_t;
+#endif
+
+        inline bool isLittleEndian() noexcept {
+            const std::uint16_t probe = 1;
+            unsigned char first = 0;
+            std::memcpy(&first, &probe, 1);
+            return first == 1;
+        }
+
+        /// @brief Writes the low `width` bytes of `value`, least significant first.
+        template <typename IntT>
+        void storeLittle(unsigned char* out, IntT value, std::size_t width) noexcept {
+            using Unsigned = typename WidthTraits<sizeof(IntT)>::Unsigned;
+            Unsigned bits = static_cast<Unsigned>(value);
+            for (std::size_t i = 0; i < width; i++) {
+                out[i] = static_cast<unsigned char>(bits);
+                bits = static_cast<Unsigned>(bits >> 8);
+            }
+        }
+
+        /// @brief Reads a `width`-byte little-endian two's complement integer.
+        inline BinaryInt loadLittle(const unsigned char* in, std::size_t width) noexcept {
+            using Unsigned = typename IntTraits<BinaryInt>::Unsigned;
+            Unsigned bits = 0;
+            for (std::size_t i = width; i-- > 0;) bits = static_cast<Unsigned>((bits << 8) | in[i]);
+            // Sign-extend from the top bit of the stored width
+            const std::size_t unused = sizeof(Unsigned) * 8 - width * 8;
+            if (unused == 0) return static_cast<BinaryInt>(bits);
+            return static_cast<BinaryInt>(static_cast<BinaryInt>(bits << unused) >> unused);
+        }
+
+        /// @brief Encodes the header.
+        void storeHeader(unsigned char (&out)[FRAC_BINARY_HEADER_SIZE], const FracBinaryInfo& info) noexcept;
+        /// @brief Reads and validates a header.
+        /// @return `IoError` if the stream ends early, `InvalidFormat` for a wrong magic, a newer version
+        /// or an unsupported width.
+        FracError readHeader(std::istream& is, FracBinaryInfo& info);
+
+        /// @brief Writes one column of `count` integers read through `at(i)`.
+        template <typename IntT, typename At>
+        bool writeColumn(std::ostream& os, std::size_t count, const At& at) {
+            unsigned char buffer[BINARY_CHUNK * sizeof(IntT)];
+            for (std::size_t first = 0; first < count; first += BINARY_CHUNK) {
+                const std::size_t size = count - first < BINARY_CHUNK ? count - first : BINARY_CHUNK;
+                for (std::size_t i = 0; i < size; i++) storeLittle(buffer + i * sizeof(IntT), at(first + i), sizeof(IntT));
+                os.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(size * sizeof(IntT)));
+            }
+            return static_cast<bool>(os);
+        }
+
+        /// @brief Reads the two columns described by `header`, appending every fraction to `out` (a vector of
+        /// `BasicFrac<IntT>`). Growing as it reads keeps a corrupt count from allocating more than the stream holds.
+        template <typename IntT, typename Vector>
+        FracError readColumns(std::istream& is, const FracBinaryInfo& header, Vector& out);
+
+        /// @brief Reads one column of `count` integers of `width` bytes, passing each to `store(i, value)` in order.
+        /// @return `IoError` if the stream ends early, `Overflow` if `store` rejects a value.
+        template <typename Store>
+        FracError readColumn(std::istream& is, std::size_t count, std::size_t width, const Store& store) {
+            unsigned char buffer[BINARY_CHUNK * sizeof(BinaryInt)];
+            for (std::size_t first = 0; first < count; first += BINARY_CHUNK) {
+                const std::size_t size = count - first < BINARY_CHUNK ? count - first : BINARY_CHUNK;
+                if (!is.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(size * width))) return FracError::IoError;
+                for (std::size_t i = 0; i < size; i++) {
+                    if (!store(first + i, loadLittle(buffer + i * width, width))) return FracError::Overflow;
+                }
+            }
+            return FracError::None;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Writing
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Writers store the fractions as they are, at the width of their storage type, and set the canonical
+    // flag when every fraction is canonical. They return `IoError` if the stream fails.
+
+    /// @brief Writes `count` fractions to `os`.
+    /// @example std::ofstream file("prices.frac", std::ios::binary); FracLib::writeBinary(file, values.data(), values.size());
+    template <typename IntT>
+    FracError writeBinary(std::ostream& os, const BasicFrac<IntT>* values, std::size_t count);
+    /// @brief Writes a single fraction to `os`.
+    template <typename IntT>
+    FracError writeBinary(std::ostream& os, const BasicFrac<IntT>& value) { return writeBinary(os, &value, 1); }
+    /// @brief Writes the fractions of a `FracArray` (or any view) as 32-bit columns.
+    FracError writeBinary(std::ostream& os, FracArrayView values);
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Reading
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Readers consume one file from `is` and replace the contents of `out` only on success. Values are
+    // converted to the storage type of `out`. They return `InvalidFormat` for a header they cannot read,
+    // `IoError` if the stream ends early, `Overflow` if a value does not fit and `ZeroDivisor` for a
+    // zero denominator. When `info` is not null it receives the header of the file.
+
+    /// @brief Reads a file into `out`.
+    /// @example std::vector<Frac64> values; FracLib::readBinary(file, values);
+    template <typename IntT>
+    FracError readBinary(std::istream& is, std::vector<BasicFrac<IntT>>& out, FracBinaryInfo* info = nullptr);
+    /// @brief Reads a file holding exactly one fraction.
+    /// @return `InvalidFormat` if the file holds a different number of fractions.
+    template <typename IntT>
+    FracError readBinary(std::istream& is, BasicFrac<IntT>& out, FracBinaryInfo* info = nullptr);
+    /// @brief Reads a file into `out`, which keeps its memory resource.
+    /// Files of 32-bit integers are read straight into the columns on little-endian hosts.
+    FracError readBinary(std::istream& is, FracArray& out, FracBinaryInfo* info = nullptr);
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Memory Mapping
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief Read-only memory mapping of a binary file of 32-bit integers, exposed as a `FracArrayView`.
+    /// Opening maps the file without reading the columns; pages are loaded by the OS as they are touched.
+    /// The contents are not validated, so the file must come from `writeBinary` (denominators non-zero).
+    /// Views stay valid until the mapping is closed, moved from or destroyed.
+    class MappedFracArray {
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Creates a closed mapping with an empty view.
+        MappedFracArray() noexcept = default;
+        MappedFracArray(const MappedFracArray& other) = delete;
+        MappedFracArray(MappedFracArray&& other) noexcept;
+        ~MappedFracArray();
+
+    public: // OPERATORS
+        MappedFracArray& operator=(const MappedFracArray& other) = delete;
+        MappedFracArray& operator=(MappedFracArray&& other) noexcept;
+        operator FracArrayView() const noexcept { return this->columns; }
+
+    public: // METHODS
+        /// @brief Zero-copy view of the mapped fractions.
+        /// @example FracLib::Frac128 total = FracLib::reduceSum(mapped.view());
+        FracArrayView view() const noexcept { return this->columns; }
+        std::size_t size() const noexcept { return this->columns.size(); }
+        bool isOpen() const noexcept { return this->address != nullptr; }
+        /// @brief Value of the canonical flag of the file.
+        bool isCanonical() const noexcept { return this->canonical; }
+        /// @brief Unmaps the file. The view becomes empty.
+        void close() noexcept;
+
+    public: // STATIC METHODS
+        /// @brief Maps the file at `path`, replacing the mapping held by `out` on success.
+        /// @return `IoError` if the file cannot be opened or mapped, `InvalidFormat` if it is not a complete
+        /// file of 32-bit integers or the host is not little-endian.
+        /// @example MappedFracArray mapped; if (MappedFracArray::open("prices.frac", mapped) == FracError::None) { ... }
+        static FracError open(const char* path, MappedFracArray& out);
+
+    private: // ATTRIBUTES
+        void* address = nullptr;
+        std::size_t length = 0;
+        FracArrayView columns;
+        bool canonical = false;
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Inline Definitions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    FracError writeBinary(std::ostream& os, const BasicFrac<IntT>* values, std::size_t count) {
+        bool isCanonical = true;
+        for (std::size_t i = 0; i < count && isCanonical; i++) isCanonical = values[i].isCanonical();
+        unsigned char header[FRAC_BINARY_HEADER_SIZE];
+        detail::storeHeader(header, FracBinaryInfo{FRAC_BINARY_VERSION, sizeof(IntT), isCanonical, count});
+        os.write(reinterpret_cast<const char*>(header), FRAC_BINARY_HEADER_SIZE);
+
+        const bool isWritten = os &&
+            detail::writeColumn<IntT>(os, count, [values](std::size_t i) { return values[i].numerator; }) &&
+            detail::writeColumn<IntT>(os, count, [values](std::size_t i) { return values[i].denominator; });
+        return isWritten ? FracError::None : FracError::IoError;
+    }
+
+    template <typename IntT, typename Vector>
+    FracError detail::readColumns(std::istream& is, const FracBinaryInfo& header, Vector& out) {
+        const std::size_t count = static_cast<std::size_t>(header.count);
+        FracError error = readColumn(is, count, header.width, [&out](std::size_t, BinaryInt value) {
+            if (!fitsIn<IntT>(value)) return false;
+            BasicFrac<IntT> frac;
+            frac.numerator = static_cast<IntT>(value);
+            out.push_back(frac);
+            return true;
+        });
+        if (error != FracError::None) return error;
+        error = readColumn(is, count, header.width, [&out](std::size_t i, BinaryInt value) {
+            if (!fitsIn<IntT>(value)) return false;
+            out[i].denominator = static_cast<IntT>(value);
+            return true;
+        });
+        if (error != FracError::None) return error;
+        for (std::size_t i = 0; i < count; i++) {
+            if (out[i].denominator == 0) return FracError::ZeroDivisor;
+        }
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    FracError readBinary(std::istream& is, std::vector<BasicFrac<IntT>>& out, FracBinaryInfo* info) {
+        FracBinaryInfo header;
+        FracError error = detail::readHeader(is, header);
+        if (error != FracError::None) return error;
+        std::vector<BasicFrac<IntT>> result;
+        error = detail::readColumns<IntT>(is, header, result);
+        if (error != FracError::None) return error;
+        out = std::move(result);
+        if (info != nullptr) *info = header;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    FracError readBinary(std::istream& is, BasicFrac<IntT>& out, FracBinaryInfo* info) {
+        FracBinaryInfo header;
+        FracError error = detail::readHeader(is, header);
+        if (error != FracError::None) return error;
+        if (header.count != 1) return FracError::InvalidFormat;
+        std::vector<BasicFrac<IntT>> result;
+        error = detail::readColumns<IntT>(is, header, result);
+        if (error != FracError::None) return error;
+        out = result[0];
+        if (info != nullptr) *info = header;
+        return FracError::None;
+    }
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_binary.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_binary_impl.h"
+#endif
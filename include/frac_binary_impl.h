@@ -0,0 +1,241 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_binary_impl.h
+ * Description:
+ *  Definitions of the binary format functions and `MappedFracArray`
+ *  declared in frac_binary.h. Mapping uses `mmap` on POSIX systems and
+ *  `MapViewOfFile` on Windows. Included by frac_binary.h in header-only mode
+ *  and compiled once into the static library by src/frac_binary.cpp
+ *  otherwise.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_binary.h"
+#include <limits>
+#include <utility>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        constexpr unsigned char BINARY_MAGIC[4] = {'F', 'R', 'A', 'C'};
+
+        FRACLIB_INLINE void storeHeader(unsigned char (&out)[FRAC_BINARY_HEADER_SIZE], const FracBinaryInfo& info) noexcept {
+            std::memset(out, 0, FRAC_BINARY_HEADER_SIZE);
+            std::memcpy(out, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+            out[4] = static_cast<unsigned char>(info.version);
+            out[5] = static_cast<unsigned char>(info.version >> 8);
+            out[6] = info.width;
+            out[7] = info.isCanonical ? BINARY_CANONICAL_FLAG : 0;
+            storeLittle(out + 8, info.count, 8);
+        }
+
+        /// @brief Decodes and validates a header already in memory.
+        FRACLIB_INLINE FracError loadHeader(const unsigned char* in, FracBinaryInfo& info) noexcept {
+            if (std::memcmp(in, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) return FracError::InvalidFormat;
+            FracBinaryInfo header{};
+            header.version = static_cast<std::uint16_t>(in[4] | (in[5] << 8));
+            header.width = in[6];
+            header.isCanonical = (in[7] & BINARY_CANONICAL_FLAG) != 0;
+            for (std::size_t i = 8; i-- > 0;) header.count = (header.count << 8) | in[8 + i];
+
+            if (header.version == 0 || header.version > FRAC_BINARY_VERSION) return FracError::InvalidFormat;
+            if (header.width != 4 && header.width != 8 && header.width != sizeof(BinaryInt)) return FracError::InvalidFormat;
+            // Both columns must be addressable
+            if (header.count > std::numeric_limits<std::size_t>::max() / 2 / header.width - FRAC_BINARY_HEADER_SIZE) {
+                return FracError::InvalidFormat;
+            }
+            info = header;
+            return FracError::None;
+        }
+
+        FRACLIB_INLINE FracError readHeader(std::istream& is, FracBinaryInfo& info) {
+            unsigned char header[FRAC_BINARY_HEADER_SIZE];
+            if (!is.read(reinterpret_cast<char*>(header), FRAC_BINARY_HEADER_SIZE)) return FracError::IoError;
+            return loadHeader(header, info);
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Writing
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracError writeBinary(std::ostream& os, FracArrayView values) {
+        bool isCanonical = true;
+        for (std::size_t i = 0; i < values.size() && isCanonical; i++) isCanonical = values.get(i).isCanonical();
+        unsigned char header[FRAC_BINARY_HEADER_SIZE];
+        detail::storeHeader(header, FracBinaryInfo{FRAC_BINARY_VERSION, sizeof(int), isCanonical, values.size()});
+        os.write(reinterpret_cast<const char*>(header), FRAC_BINARY_HEADER_SIZE);
+
+        // The columns already have the file layout on little-endian hosts
+        if (detail::isLittleEndian()) {
+            const std::streamsize bytes = static_cast<std::streamsize>(values.size() * sizeof(int));
+            os.write(reinterpret_cast<const char*>(values.numerators()), bytes);
+            os.write(reinterpret_cast<const char*>(values.denominators()), bytes);
+            return os ? FracError::None : FracError::IoError;
+        }
+        const bool isWritten = os &&
+            detail::writeColumn<int>(os, values.size(), [&values](std::size_t i) { return values.numerators()[i]; }) &&
+            detail::writeColumn<int>(os, values.size(), [&values](std::size_t i) { return values.denominators()[i]; });
+        return isWritten ? FracError::None : FracError::IoError;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Reading
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracError readBinary(std::istream& is, FracArray& out, FracBinaryInfo* info) {
+        FracBinaryInfo header;
+        FracError error = detail::readHeader(is, header);
+        if (error != FracError::None) return error;
+        const std::size_t count = static_cast<std::size_t>(header.count);
+        FracArray result(out.resource());
+
+        if (header.width == sizeof(int) && detail::isLittleEndian()) {
+            // Read straight into the columns, growing a chunk at a time so a corrupt count fails at the end of the stream
+            constexpr std::size_t STEP = std::size_t(1) << 20;
+            const auto readInto = [&is, &result, count](int* (FracArray::*column)()) {
+                for (std::size_t first = 0; first < count; first += STEP) {
+                    const std::size_t size = count - first < STEP ? count - first : STEP;
+                    if (result.size() < first + size) result.resize(first + size);
+                    char* target = reinterpret_cast<char*>((result.*column)() + first);
+                    if (!is.read(target, static_cast<std::streamsize>(size * sizeof(int)))) return false;
+                }
+                return true;
+            };
+            if (!readInto(&FracArray::numerators) || !readInto(&FracArray::denominators)) return FracError::IoError;
+            for (std::size_t i = 0; i < count; i++) {
+                if (result.denominators()[i] == 0) return FracError::ZeroDivisor;
+            }
+        } else {
+            std::vector<Frac> values;
+            error = detail::readColumns<int>(is, header, values);
+            if (error != FracError::None) return error;
+            result.reserve(values.size());
+            for (const Frac& value : values) result.push_back(value);
+        }
+
+        out = std::move(result);
+        if (info != nullptr) *info = header;
+        return FracError::None;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Memory Mapping
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE MappedFracArray::MappedFracArray(MappedFracArray&& other) noexcept :
+        address(std::exchange(other.address, nullptr)), length(std::exchange(other.length, 0)),
+        columns(std::exchange(other.columns, FracArrayView())), canonical(std::exchange(other.canonical, false)) {}
+
+    FRACLIB_INLINE MappedFracArray::~MappedFracArray() {
+        this->close();
+    }
+
+    FRACLIB_INLINE MappedFracArray& MappedFracArray::operator=(MappedFracArray&& other) noexcept {
+        if (this != &other) {
+            this->close();
+            this->address = std::exchange(other.address, nullptr);
+            this->length = std::exchange(other.length, 0);
+            this->columns = std::exchange(other.columns, FracArrayView());
+            this->canonical = std::exchange(other.canonical, false);
+        }
+        return *this;
+    }
+
+    FRACLIB_INLINE void MappedFracArray::close() noexcept {
+        if (this->address != nullptr) {
+#ifdef _WIN32
+            UnmapViewOfFile(this->address);
+#else
+            munmap(this->address, this->length);
+#endif
+        }
+        this->address = nullptr;
+        this->length = 0;
+        this->columns = FracArrayView();
+        this->canonical = false;
+    }
+
+    FRACLIB_INLINE FracError MappedFracArray::open(const char* path, MappedFracArray& out) {
+        if (!detail::isLittleEndian()) return FracError::InvalidFormat;
+
+        MappedFracArray result;
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return FracError::IoError;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(FRAC_BINARY_HEADER_SIZE)) {
+            CloseHandle(file);
+            return size.QuadPart < static_cast<LONGLONG>(FRAC_BINARY_HEADER_SIZE) ? FracError::InvalidFormat : FracError::IoError;
+        }
+        // The view keeps the mapping alive, so both handles can be closed right away
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) return FracError::IoError;
+        result.address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (result.address == nullptr) return FracError::IoError;
+        result.length = static_cast<std::size_t>(size.QuadPart);
+#else
+        const int file = ::open(path, O_RDONLY);
+        if (file < 0) return FracError::IoError;
+        struct stat status;
+        if (fstat(file, &status) != 0) {
+            ::close(file);
+            return FracError::IoError;
+        }
+        if (status.st_size < static_cast<off_t>(FRAC_BINARY_HEADER_SIZE)) {
+            ::close(file);
+            return FracError::InvalidFormat;
+        }
+        // The mapping outlives the descriptor
+        void* address = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+        ::close(file);
+        if (address == MAP_FAILED) return FracError::IoError;
+        result.address = address;
+        result.length = static_cast<std::size_t>(status.st_size);
+#endif
+
+        const unsigned char* bytes = static_cast<const unsigned char*>(result.address);
+        FracBinaryInfo header;
+        const FracError error = detail::loadHeader(bytes, header);
+        if (error != FracError::None) return error;
+        const std::size_t count = static_cast<std::size_t>(header.count);
+        if (header.width != sizeof(int) || result.length < FRAC_BINARY_HEADER_SIZE + 2 * count * sizeof(int)) {
+            return FracError::InvalidFormat;
+        }
+
+        const int* numerators = reinterpret_cast<const int*>(bytes + FRAC_BINARY_HEADER_SIZE);
+        result.columns = FracArrayView(numerators, numerators + count, count);
+        result.canonical = header.isCanonical;
+        out = std::move(result);
+        return FracError::None;
+    }
+}
@@ -0,0 +1,276 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_cache.h
+ * Description:
+ *  This header file defines the optional conversion cache of FracLib, which
+ *  remembers the fractions that the `const char*` and `float` operator
+ *  overloads (ie. `f + "1/2"`, `f < 0.25f`) build from their operands.
+ *
+ *  The cache is off by default. It can be enabled for every thread with
+ *  `setGlobalConversionCache` or for the calling thread with
+ *  `setThreadConversionCache`, which takes precedence. Each thread fills
+ *  its own table, one per storage width, so lookups take no locks and
+ *  threads never contend. A table holds a bounded number of entries in
+ *  4-way buckets, evicting within the bucket when it is full. Keys are the
+ *  text of a string operand (strings longer than `CONVERSION_CACHE_KEY_CHARS`
+ *  are not cached) or the bits of a float operand. Operands that fail to
+ *  convert are never cached, so errors are reported on every call.
+ *
+ *  Hits, misses and evictions of the calling thread are reported by
+ *  `conversionCacheStats()`.
+ *
+ *  This file is included by `frac.h`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_traits.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace FracLib {
+    /// @brief Default number of entries of each table.
+    constexpr std::size_t CONVERSION_CACHE_CAPACITY = 4096;
+    /// @brief Longest string operand that is cached.
+    constexpr std::size_t CONVERSION_CACHE_KEY_CHARS = 23;
+
+    /// @brief Cache setting of one thread.
+    enum class FracCacheMode : unsigned char {
+        Inherit = 0,    ///< Follow `setGlobalConversionCache`.
+        Enabled,        ///< Cache on this thread, whatever the global setting.
+        Disabled        ///< Never cache on this thread.
+    };
+
+    /// @brief Conversion cache counters of the calling thread, see `conversionCacheStats()`.
+    struct FracCacheStats {
+        std::uint64_t hits = 0;         ///< Operands found in the cache.
+        std::uint64_t misses = 0;       ///< Operands converted while the cache was enabled, including strings too long to cache.
+        std::uint64_t evictions = 0;    ///< Entries replaced because their bucket was full.
+        std::size_t entries = 0;        ///< Entries currently held.
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        inline std::atomic<bool> isGlobalCacheEnabled{false};
+        inline std::atomic<std::size_t> globalCacheCapacity{CONVERSION_CACHE_CAPACITY};
+        /// @brief Bumped by every `setGlobalConversionCache`, so threads drop their tables on next use.
+        inline std::atomic<std::uint64_t> globalCacheGeneration{0};
+
+        inline thread_local FracCacheMode threadCacheMode = FracCacheMode::Inherit;
+        /// @brief Capacity of this thread's tables, `0` to use the global capacity.
+        inline thread_local std::size_t threadCacheCapacity = 0;
+        /// @brief Bumped by the thread settings, so this thread's tables are rebuilt on next use.
+        inline thread_local std::uint64_t threadCacheGeneration = 0;
+
+        /// @brief True when operand conversions on the calling thread go through the cache.
+        inline bool isCacheEnabled() noexcept {
+            return threadCacheMode == FracCacheMode::Enabled ||
+                (threadCacheMode == FracCacheMode::Inherit && isGlobalCacheEnabled.load(std::memory_order_relaxed));
+        }
+
+        /// @brief Bounded table from operand keys to the numerator and denominator they convert to.
+        /// Used by one thread only.
+        template <typename IntT>
+        class ConversionCache {
+        public: // TYPES
+            /// @brief Operand text padded with zeros, or the bits of a float, with the key kind in the top byte.
+            struct Key {
+                std::uint64_t words[3] = {};
+            };
+
+        public: // METHODS
+            /// @brief Builds the key of a string operand.
+            /// @return false if `text` is longer than `CONVERSION_CACHE_KEY_CHARS`, which is counted as a miss.
+            bool makeKey(const char* text, Key& key) noexcept {
+                // Packed in registers rather than through a byte buffer, whose narrow stores would stall the wide loads
+                std::size_t i = 0;
+                for (; i < CONVERSION_CACHE_KEY_CHARS && text[i] != '\0'; i++) {
+                    key.words[i / 8] |= static_cast<std::uint64_t>(static_cast<unsigned char>(text[i])) << (i % 8 * 8);
+                }
+                if (text[i] != '\0') {
+                    this->counters.misses++;
+                    return false;
+                }
+                key.words[2] |= KIND_TEXT;
+                return true;
+            }
+            /// @brief Builds the key of a float operand from its bits.
+            static Key makeKey(float value) noexcept {
+                std::uint32_t bits = 0;
+                std::memcpy(&bits, &value, sizeof(bits));
+                Key key;
+                key.words[0] = bits;
+                key.words[2] = KIND_FLOAT;
+                return key;
+            }
+
+            /// @brief Looks up `key`, counting a hit or a miss.
+            bool find(const Key& key, IntT& numerator, IntT& denominator) {
+                this->prepare();
+                Entry* slots = this->bucket(key);
+                for (std::size_t i = 0; i < WAYS; i++) {
+                    if (isSameKey(slots[i].key, key)) {
+                        numerator = slots[i].numerator;
+                        denominator = slots[i].denominator;
+                        this->counters.hits++;
+                        return true;
+                    }
+                }
+                this->counters.misses++;
+                return false;
+            }
+
+            /// @brief Stores the conversion of `key`, replacing an entry of its bucket if the bucket is full.
+            void insert(const Key& key, IntT numerator, IntT denominator) noexcept {
+                if (this->entries.empty()) return;
+                Entry* slots = this->bucket(key);
+                Entry* target = nullptr;
+                for (std::size_t i = 0; i < WAYS && target == nullptr; i++) {
+                    if (slots[i].key.words[2] == 0) target = slots + i;
+                }
+                if (target == nullptr) {
+                    // Full bucket, the victim is picked from hash bits the bucket index does not use
+                    target = slots + (hashOf(key) >> 30 & (WAYS - 1));
+                    this->counters.evictions++;
+                } else {
+                    this->counters.entries++;
+                }
+                target->key = key;
+                target->numerator = numerator;
+                target->denominator = denominator;
+            }
+
+            /// @brief Drops every entry and frees the table, keeping the counters unless `isResettingStats`.
+            void clear(bool isResettingStats) noexcept {
+                std::vector<Entry>().swap(this->entries);
+                this->counters.entries = 0;
+                if (isResettingStats) this->counters = FracCacheStats();
+            }
+            const FracCacheStats& stats() const noexcept { return this->counters; }
+
+        private: // TYPES
+            /// @brief Key kinds, in the top byte of the last word. Text never reaches it, empty slots are all zero.
+            static constexpr std::uint64_t KIND_TEXT = std::uint64_t(1) << 56;
+            static constexpr std::uint64_t KIND_FLOAT = std::uint64_t(2) << 56;
+            static constexpr std::size_t WAYS = 4;
+
+            struct Entry {
+                Key key;
+                IntT numerator = 0;
+                IntT denominator = 1;
+            };
+
+        private: // PRIVATE FUNCTIONS
+            static bool isSameKey(const Key& a, const Key& b) noexcept {
+                return ((a.words[0] ^ b.words[0]) | (a.words[1] ^ b.words[1]) | (a.words[2] ^ b.words[2])) == 0;
+            }
+            static std::uint64_t hashOf(const Key& key) noexcept {
+                // Multiplicative mixing, callers take the well-mixed high bits
+                return (key.words[0] ^ (key.words[1] * 0xC2B2AE3D27D4EB4Full) ^ key.words[2]) * 0x9E3779B97F4A7C15ull;
+            }
+
+            /// @brief Rebuilds the table when a setting changed since it was filled, allocating it on first use.
+            void prepare() {
+                const std::uint64_t global = globalCacheGeneration.load(std::memory_order_relaxed);
+                if (this->globalGeneration == global && this->threadGeneration == threadCacheGeneration && !this->entries.empty()) return;
+                this->rebuild(global);
+            }
+            void rebuild(std::uint64_t global) {
+                std::size_t capacity = threadCacheCapacity != 0 ? threadCacheCapacity : globalCacheCapacity.load(std::memory_order_relaxed);
+                std::size_t size = WAYS;
+                while (size < capacity) size <<= 1;
+                std::vector<Entry>(size).swap(this->entries);
+                this->counters.entries = 0;
+                this->globalGeneration = global;
+                this->threadGeneration = threadCacheGeneration;
+            }
+
+            Entry* bucket(const Key& key) noexcept {
+                return this->entries.data() + (static_cast<std::size_t>(hashOf(key) >> 32) & (this->entries.size() - 1) & ~(WAYS - 1));
+            }
+
+        private: // ATTRIBUTES
+            std::vector<Entry> entries;
+            FracCacheStats counters;
+            std::uint64_t globalGeneration = 0;
+            std::uint64_t threadGeneration = 0;
+        };
+
+        /// @brief Conversion cache of the calling thread for `BasicFrac<IntT>`.
+        template <typename IntT>
+        ConversionCache<IntT>& threadConversionCache() {
+            static thread_local ConversionCache<IntT> cache;
+            return cache;
+        }
+
+        /// @brief Calls `fn(ConversionCache<IntT>&)` for the table of every storage width.
+        template <typename Fn>
+        void forEachConversionCache(Fn fn) {
+            fn(threadConversionCache<int>());
+            fn(threadConversionCache<std::int64_t>());
+#ifdef FRACLIB_HAS_INT128
+            fn(threadConversionCache<__int128>());
+#endif
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Settings
+    //\\\\\\\\\\\\\\\\\\\\/
+    // A capacity is rounded up to a power of two of at least 4 entries per table, with one table per
+    // storage width and thread. Changing a setting empties the affected tables on their next use.
+
+    /// @brief Enables or disables the cache for every thread whose mode is `FracCacheMode::Inherit`.
+    /// @param capacity entries of each table of threads without their own capacity.
+    /// @example FracLib::setGlobalConversionCache(true);
+    inline void setGlobalConversionCache(bool isEnabled, std::size_t capacity = CONVERSION_CACHE_CAPACITY) noexcept {
+        detail::globalCacheCapacity.store(capacity, std::memory_order_relaxed);
+        detail::globalCacheGeneration.fetch_add(1, std::memory_order_relaxed);
+        detail::isGlobalCacheEnabled.store(isEnabled, std::memory_order_relaxed);
+    }
+
+    /// @brief Sets the cache mode of the calling thread.
+    /// @param capacity entries of each table of this thread, `0` for the global capacity.
+    /// @example FracLib::setThreadConversionCache(FracLib::FracCacheMode::Enabled, 1024);
+    inline void setThreadConversionCache(FracCacheMode mode, std::size_t capacity = 0) noexcept {
+        detail::threadCacheMode = mode;
+        detail::threadCacheCapacity = capacity;
+        detail::threadCacheGeneration++;
+    }
+
+    /// @brief True when operand conversions on the calling thread use the cache.
+    inline bool isConversionCacheEnabled() noexcept { return detail::isCacheEnabled(); }
+
+    /// @brief Counters of the calling thread, summed over its tables.
+    inline FracCacheStats conversionCacheStats() {
+        FracCacheStats total;
+        detail::forEachConversionCache([&total](const auto& cache) {
+            total.hits += cache.stats().hits;
+            total.misses += cache.stats().misses;
+            total.evictions += cache.stats().evictions;
+            total.entries += cache.stats().entries;
+        });
+        return total;
+    }
+
+    /// @brief Empties and frees the tables of the calling thread and sets its counters back to zero.
+    inline void clearConversionCache() {
+        detail::forEachConversionCache([](auto& cache) { cache.clear(true); });
+    }
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_context.h
+ * Description:
+ *  This header file defines `BasicFracContext`, bounded-denominator
+ *  arithmetic for workloads that want fractions but not exact results,
+ *  such as simulations whose exact values grow until they overflow.
+ *
+ *  A context holds a maximum denominator `N`. Each operation computes the
+ *  exact result in the widened type, where it always fits, then rounds it
+ *  to the closest fraction with a denominator of at most `N` (the best
+ *  rational approximation, found from its continued fraction convergents
+ *  and semiconvergents). Operands therefore stay machine-word sized and the
+ *  cost of an operation stays bounded. The only errors left are division
+ *  by zero and results whose integer part does not fit in `IntT`.
+ *
+ *  The context records the rounding error of every result it produces:
+ *  `errorBound()` is their sum, which bounds how far a chain of additions
+ *  and subtractions of exact inputs has drifted from the exact result.
+ *  Multiplication and division also scale the error already carried by
+ *  their operands, which the context does not see. A context is not
+ *  thread-safe, use one per thread.
+ *
+ *  This file is included by `frac.h`, which names it `BasicFrac::Context`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstdint>
+
+namespace FracLib {
+    /// @brief Arithmetic on `BasicFrac<IntT>` that rounds every result to a denominator of at most
+    /// `maxDenominator()` and tracks the rounding error.
+    /// @tparam IntT storage type, which needs a wider type for the exact intermediate results.
+    /// @example Frac::Context context(1000); Frac y = context.mul(x, Frac(7, 3));
+    template <typename IntT>
+    class BasicFracContext {
+        static_assert(detail::IntTraits<IntT>::isWidened, "BasicFracContext needs a wider type than IntT for exact intermediate results.");
+
+    public: // TYPES
+        using FracType = BasicFrac<IntT>;
+
+    public: // CONSTRUCTORS
+        /// @brief Creates a context rounding to denominators of at most `maxDenominator`.
+        /// @throws std::invalid_argument if `maxDenominator` is less than 1 (`FracError::ZeroDivisor`).
+        explicit BasicFracContext(IntT maxDenominator) : limit(maxDenominator) {
+            if (maxDenominator < 1) detail::raise(FracError::ZeroDivisor);
+        }
+
+    public: // ACCESSORS
+        IntT maxDenominator() const noexcept { return this->limit; }
+        /// @brief Sum of the rounding errors `|exact - result|` of every result since the last `resetErrors()`.
+        double errorBound() const noexcept { return this->totalError; }
+        /// @brief Largest rounding error of a single result.
+        double maxError() const noexcept { return this->largestError; }
+        /// @brief Successful operations, and how many of them had to be rounded.
+        std::uint64_t operations() const noexcept { return this->operationCount; }
+        std::uint64_t roundings() const noexcept { return this->roundedCount; }
+        /// @brief Sets the error and operation counters back to zero.
+        void resetErrors() noexcept {
+            this->totalError = 0;
+            this->largestError = 0;
+            this->operationCount = 0;
+            this->roundedCount = 0;
+        }
+
+    public: // ARITHMETIC
+        // `out` is left unchanged on failure, and failures are not counted.
+
+        /// @brief `a + b`, rounded.
+        /// @return `Overflow` if the integer part of the result does not fit, `ZeroDivisor` for a zero denominator.
+        FracError tryAdd(const FracType& a, const FracType& b, FracType& out) noexcept {
+            return this->combine(a, b, false, out);
+        }
+        /// @brief `a - b`, rounded.
+        FracError trySub(const FracType& a, const FracType& b, FracType& out) noexcept {
+            return this->combine(a, b, true, out);
+        }
+        /// @brief `a * b`, rounded.
+        FracError tryMul(const FracType& a, const FracType& b, FracType& out) noexcept {
+            Wide n = 0, d = 0;
+            FracType::productWide(a.numerator, a.denominator, b.numerator, b.denominator, n, d);
+            return this->finish(n, d, out);
+        }
+        /// @brief `a / b`, rounded.
+        /// @return `ZeroDivisor` if `b` is zero, or the errors of `tryAdd`.
+        FracError tryDiv(const FracType& a, const FracType& b, FracType& out) noexcept {
+            if (b.numerator == 0) {
+                return FracError::ZeroDivisor;
+            }
+            Wide n = 0, d = 0;
+            FracType::productWide(a.numerator, a.denominator, b.denominator, b.numerator, n, d);
+            return this->finish(n, d, out);
+        }
+        /// @brief `value` rounded to the bound, ie. to bring an exact value into the context.
+        FracError tryRound(const FracType& value, FracType& out) noexcept {
+            return this->finish(value.numerator, value.denominator, out);
+        }
+
+        /// @brief Throwing forms of the functions above.
+        /// @throws std::overflow_error or std::invalid_argument on the errors of the `try*` forms.
+        FracType add(const FracType& a, const FracType& b) { return this->apply(&BasicFracContext::tryAdd, a, b); }
+        FracType sub(const FracType& a, const FracType& b) { return this->apply(&BasicFracContext::trySub, a, b); }
+        FracType mul(const FracType& a, const FracType& b) { return this->apply(&BasicFracContext::tryMul, a, b); }
+        FracType div(const FracType& a, const FracType& b) { return this->apply(&BasicFracContext::tryDiv, a, b); }
+        FracType round(const FracType& value) {
+            FracType result;
+            detail::throwOnError(this->tryRound(value, result));
+            return result;
+        }
+
+    private: // TYPES
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        using TryOp = FracError (BasicFracContext::*)(const FracType&, const FracType&, FracType&) noexcept;
+
+    private: // PRIVATE FUNCTIONS
+        FracError combine(const FracType& a, const FracType& b, bool isSubtracting, FracType& out) noexcept {
+            // Cross products of `IntT` values always fit in `Wide`, but their sum overflows when every part is the
+            // minimum. All three products are then the same power of two, so halving them is exact.
+            Wide left = static_cast<Wide>(a.numerator) * b.denominator;
+            Wide right = static_cast<Wide>(b.numerator) * a.denominator;
+            Wide denominator = static_cast<Wide>(a.denominator) * b.denominator;
+            Wide sum = 0;
+            const auto combineParts = [&]() {
+                return isSubtracting ? detail::subOverflow(left, right, sum) : detail::addOverflow(left, right, sum);
+            };
+            if (combineParts()) {
+                left /= 2;
+                right /= 2;
+                denominator /= 2;
+                combineParts();
+            }
+            return this->finish(sum, denominator, out);
+        }
+
+        /// @brief Rounds the exact result `n/d` into `out` and records its error.
+        FracError finish(Wide n, Wide d, FracType& out) noexcept {
+            FracType result;
+            double error = 0;
+            const FracError status = FracType::roundWide(n, d, this->limit, result, error);
+            if (status != FracError::None) {
+                return status;
+            }
+            this->operationCount++;
+            if (error != 0) {
+                this->roundedCount++;
+                this->totalError += error;
+                if (error > this->largestError) this->largestError = error;
+            }
+            out = result;
+            return FracError::None;
+        }
+
+        FracType apply(TryOp op, const FracType& a, const FracType& b) {
+            FracType result;
+            detail::throwOnError((this->*op)(a, b, result));
+            return result;
+        }
+
+    private: // ATTRIBUTES
+        IntT limit;
+        double totalError = 0;
+        double largestError = 0;
+        std::uint64_t operationCount = 0;
+        std::uint64_t roundedCount = 0;
+    };
+
+    /// @brief Bounded-denominator arithmetic on `Frac`.
+    using FracContext = BasicFracContext<int>;
+#ifdef FRACLIB_HAS_INT128
+    /// @brief Bounded-denominator arithmetic on `Frac64`, with 128-bit intermediate results.
+    using FracContext64 = BasicFracContext<std::int64_t>;
+#endif
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_error.h
+ * Description:
+ *  This header file defines `FracError`, the status code returned by the
+ *  non-throwing (`try*`) API of `BasicFrac`, the result types of the
+ *  zero-allocation parser and bulk formatter, together with the error strings
+ *  and the single point where a status is turned into an exception.
+ *
+ *  The throwing operators are implemented on top of the `try*` functions and
+ *  call `detail::raise` only when a status is not `FracError::None`. When the
+ *  library is compiled with exceptions disabled (`-fno-exceptions`), `raise`
+ *  calls `std::abort()` instead, so code that needs to recover from errors
+ *  should use the `try*` functions.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <system_error>
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define FRACLIB_HAS_EXCEPTIONS 1
+    #include <stdexcept>
+#else
+    #include <cstdlib>
+#endif
+
+namespace FracLib {
+    /// @brief Status returned by the non-throwing `BasicFrac::try*` functions.
+    enum class FracError : unsigned char {
+        None = 0,       ///< Success, the output was written.
+        ZeroDivisor,    ///< A denominator or divisor was zero.
+        Overflow,       ///< The result does not fit in the storage type.
+        InvalidString,  ///< The text is not an accepted fraction format.
+        NotFinite,      ///< A floating-point input was infinite or NaN.
+        SizeMismatch,   ///< Arrays passed to a batch operation have different lengths, or matrix dimensions do not match.
+        InvalidFormat,  ///< The data is not a FracLib binary file of a supported version and integer width.
+        IoError,        ///< Reading, writing or mapping a stream or file failed.
+        Singular,       ///< The matrix of a linear system or inversion has no inverse.
+        Inexact         ///< The value is not a whole number of ticks of a `FixedFrac` denominator.
+    };
+
+    /// @brief Result of `BasicFrac::fromChars`, in the style of `std::from_chars_result`.
+    struct FracParseResult {
+        const char* ptr;    ///< One past the last character consumed, or where the error was found.
+        FracError error;    ///< `FracError::None` on success.
+    };
+
+    /// @brief Result of `BasicFrac::toCharsBulk`.
+    struct FracWriteResult {
+        char* ptr;          ///< One past the last complete value (and separator) written.
+        std::size_t count;  ///< Number of fractions written.
+        std::errc ec;       ///< `std::errc()` on success, `std::errc::value_too_large` if the buffer filled up.
+    };
+
+    namespace detail {
+        constexpr const char* ZERO_DIVISOR_MESSAGE = "Division by zero not allowed. Denominator cannot be zero.";
+        constexpr const char* OVERFLOW_MESSAGE = "Integer overflow detected.";
+        constexpr const char* INVALID_STRING_PARAMETER_MESSAGE = "Improper format. Accepted fraction form: (ie \"1/2\" or \"25\" or  \"3 1/2\").";
+        constexpr const char* NOT_FINITE_MESSAGE = "Decimal must be a finite number.";
+        constexpr const char* SIZE_MISMATCH_MESSAGE = "Operands must have the same length or matching dimensions.";
+        constexpr const char* INVALID_FORMAT_MESSAGE = "Not a FracLib binary file of a supported version and integer width.";
+        constexpr const char* IO_ERROR_MESSAGE = "Reading or writing the stream or file failed.";
+        constexpr const char* SINGULAR_MESSAGE = "The matrix is singular.";
+        constexpr const char* INEXACT_MESSAGE = "The value is not a multiple of the fixed denominator.";
+    }
+
+    /// @brief Returns the message the throwing API uses for `error`.
+    /// @example std::puts(FracLib::errorMessage(FracLib::FracError::Overflow));
+    constexpr const char* errorMessage(FracError error) noexcept {
+        switch (error) {
+            case FracError::ZeroDivisor: return detail::ZERO_DIVISOR_MESSAGE;
+            case FracError::Overflow: return detail::OVERFLOW_MESSAGE;
+            case FracError::InvalidString: return detail::INVALID_STRING_PARAMETER_MESSAGE;
+            case FracError::NotFinite: return detail::NOT_FINITE_MESSAGE;
+            case FracError::SizeMismatch: return detail::SIZE_MISMATCH_MESSAGE;
+            case FracError::InvalidFormat: return detail::INVALID_FORMAT_MESSAGE;
+            case FracError::IoError: return detail::IO_ERROR_MESSAGE;
+            case FracError::Singular: return detail::SINGULAR_MESSAGE;
+            case FracError::Inexact: return detail::INEXACT_MESSAGE;
+            default: return "";
+        }
+    }
+
+    namespace detail {
+        /// @brief Reports `error` from the throwing API.
+        /// Throws `std::overflow_error` for `Overflow` and `std::invalid_argument` otherwise,
+        /// or aborts when exceptions are disabled.
+        /// @param message optional message overriding `errorMessage(error)`.
+        [[noreturn]] inline void raise(FracError error, const char* message = nullptr) {
+#ifdef FRACLIB_HAS_EXCEPTIONS
+            if (message == nullptr) message = errorMessage(error);
+            if (error == FracError::Overflow) {
+                throw std::overflow_error(message);
+            }
+            throw std::invalid_argument(message);
+#else
+            (void)error;
+            (void)message;
+            std::abort();
+#endif
+        }
+
+        /// @brief Calls `raise` if `error` is not `FracError::None`.
+        constexpr void throwOnError(FracError error) {
+            if (error != FracError::None) raise(error);
+        }
+    }
+}
@@ -0,0 +1,469 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_fixed.h
+ * Description:
+ *  This header file defines the FixedFrac class template, a fraction whose
+ *  denominator is the compile-time constant `Den`, for price-like data that
+ *  is counted in ticks such as 1/100 or 1/256.
+ *
+ *  Only the numerator (the number of ticks) is stored, so a `FixedFrac` has
+ *  the size and layout of `IntT` and an array of them is an array of
+ *  integers. Addition, subtraction, negation, scaling by an integer and
+ *  comparisons are integer operations with an overflow check: there is no
+ *  cross multiplication and nothing to simplify. The batch functions check
+ *  overflow without branches, so their loops vectorize.
+ *
+ *  Values convert to `BasicFrac` exactly (`value()`), and from `BasicFrac`
+ *  either exactly (`tryConvert`, which reports `FracError::Inexact` for a
+ *  value between two ticks) or to the nearest tick (`tryRound`).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+
+namespace FracLib {
+    /// @brief Fraction `ticks / Den` with a fixed positive denominator, stored as its `IntT` numerator.
+    /// Results equal those of the matching `BasicFrac` operations. Overflow is checked on the tick count:
+    /// an operation fails when its result has more ticks than `IntT` holds, even where `BasicFrac` would
+    /// reduce the same value and succeed.
+    /// @tparam Den denominator shared by every value, which must fit in `IntT`.
+    /// @tparam IntT signed integer storage type, as for `BasicFrac`.
+    /// @example FixedFrac<100> price = FixedFrac<100>::fromTicks(1999); // 19.99
+    template <std::int64_t Den, typename IntT = int>
+    class FixedFrac {
+        static_assert(detail::IsFracInt<IntT>::value, "FixedFrac requires a 32, 64 or 128-bit signed integer type.");
+        static_assert(Den > 0 && Den <= detail::IntTraits<IntT>::max,
+            "FixedFrac requires a positive denominator that fits in IntT.");
+
+    public: // TYPES
+        using value_type = IntT;
+        using frac_type = BasicFrac<IntT>;
+
+    public: // CONSTANTS
+        static constexpr IntT DENOMINATOR = static_cast<IntT>(Den);
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Initializes the value to `0`.
+        constexpr FixedFrac() noexcept : tickCount(0) {}
+        /// @brief Constructs the whole number `n`, ie. `n * Den` ticks.
+        /// @throws std::overflow_error if `n * Den` does not fit in `IntT`.
+        /// @example FixedFrac<100> f(5); // 500 ticks
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        constexpr FixedFrac(T n);
+        /// @brief Converts a fraction exactly.
+        /// @throws std::invalid_argument if `frac` is not a whole number of ticks (`FracError::Inexact`).
+        /// @throws std::overflow_error if the number of ticks does not fit in `IntT`.
+        /// @example FixedFrac<100> f(Frac(3, 4)); // 75 ticks
+        explicit constexpr FixedFrac(const BasicFrac<IntT>& frac);
+        constexpr FixedFrac(const FixedFrac& other) noexcept = default;
+        constexpr FixedFrac(FixedFrac&& other) noexcept = default;
+
+        /// @brief The value `ticks / Den`.
+        static constexpr FixedFrac fromTicks(IntT ticks) noexcept {
+            FixedFrac result;
+            result.tickCount = ticks;
+            return result;
+        }
+
+    public: // OPERATORS
+        // Integers convert implicitly, so either operand of `+` and `-` may be one.
+        friend constexpr FixedFrac operator+(const FixedFrac& a, const FixedFrac& b) { return apply(tryAdd, a, b); }
+        friend constexpr FixedFrac operator-(const FixedFrac& a, const FixedFrac& b) { return apply(trySub, a, b); }
+        friend constexpr FixedFrac operator*(const FixedFrac& a, IntT factor) { return scale(a, factor); }
+        friend constexpr FixedFrac operator*(IntT factor, const FixedFrac& a) { return scale(a, factor); }
+
+        constexpr FixedFrac& operator+=(const FixedFrac& other);
+        constexpr FixedFrac& operator-=(const FixedFrac& other);
+        constexpr FixedFrac& operator*=(IntT factor);
+
+        constexpr FixedFrac operator-() const;
+
+        // Comparision
+        friend constexpr bool operator==(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount == b.tickCount; }
+        friend constexpr bool operator!=(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount != b.tickCount; }
+        friend constexpr bool operator<(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount < b.tickCount; }
+        friend constexpr bool operator<=(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount <= b.tickCount; }
+        friend constexpr bool operator>(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount > b.tickCount; }
+        friend constexpr bool operator>=(const FixedFrac& a, const FixedFrac& b) noexcept { return a.tickCount >= b.tickCount; }
+#ifdef FRACLIB_HAS_THREE_WAY_COMPARISON
+        friend constexpr std::weak_ordering operator<=>(const FixedFrac& a, const FixedFrac& b) noexcept {
+            return a.tickCount < b.tickCount ? std::weak_ordering::less :
+                (a.tickCount > b.tickCount ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+        }
+#endif
+
+        // Assignment
+        constexpr FixedFrac& operator=(const FixedFrac& other) noexcept = default;
+        constexpr FixedFrac& operator=(FixedFrac&& other) noexcept = default;
+
+        // Insertion
+        /// @brief Writes the value in lowest terms, as `BasicFrac` does.
+        friend std::ostream& operator<<(std::ostream& os, const FixedFrac& frac) { return os << frac.value(); }
+
+    public: // METHODS
+        /// @brief Stored numerator, the number of `1/Den` ticks.
+        constexpr IntT ticks() const noexcept { return this->tickCount; }
+        /// @brief The value as a fraction in lowest terms. Costs one GCD with `Den`.
+        /// @example Frac f = FixedFrac<100>::fromTicks(25).value(); // 1/4
+        constexpr BasicFrac<IntT> value() const noexcept;
+        /// @brief Hash of the value, equal to `BasicFrac::hash` of the same value. `std::hash` uses this.
+        constexpr std::size_t hash() const noexcept { return this->value().hash(); }
+
+    public: // STATIC METHODS
+        /// @brief Converts the value to a string in lowest terms (ie. "1/4").
+        static std::string toString(const FixedFrac& frac) { return BasicFrac<IntT>::toString(frac.value()); }
+        static constexpr double toDouble(const FixedFrac& frac) {
+            return static_cast<double>(frac.tickCount) / static_cast<double>(DENOMINATOR);
+        }
+
+    public: // NON-THROWING API
+        // As in `BasicFrac`, every function returns `FracError::None` and writes `out` on success, leaves
+        // `out` unchanged on failure, and `out` may alias an input.
+
+        /// @brief Creates the whole number `n`.
+        /// @return `Overflow` if `n * Den` does not fit in `IntT`.
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        static constexpr FracError tryMake(T n, FixedFrac& out) noexcept;
+        /// @brief Converts a fraction exactly.
+        /// @return `Inexact` if `frac` is not a whole number of ticks, `ZeroDivisor` for a zero denominator,
+        /// `Overflow` if the number of ticks does not fit in `IntT`.
+        static constexpr FracError tryConvert(const BasicFrac<IntT>& frac, FixedFrac& out) noexcept;
+        /// @brief Converts a fraction to the nearest tick, halfway cases rounded away from zero.
+        /// @return `ZeroDivisor` for a zero denominator, `Overflow` if the number of ticks does not fit in `IntT`.
+        /// @example FixedFrac<100> f; FixedFrac<100>::tryRound(Frac(1, 3), f); // 33 ticks
+        static constexpr FracError tryRound(const BasicFrac<IntT>& frac, FixedFrac& out) noexcept;
+        /// @return `Overflow` if the sum does not fit in `IntT`.
+        static constexpr FracError tryAdd(const FixedFrac& a, const FixedFrac& b, FixedFrac& out) noexcept;
+        /// @return `Overflow` if the difference does not fit in `IntT`.
+        static constexpr FracError trySub(const FixedFrac& a, const FixedFrac& b, FixedFrac& out) noexcept;
+        /// @brief Computes `a * factor`.
+        /// @return `Overflow` if the product does not fit in `IntT`.
+        static constexpr FracError tryMul(const FixedFrac& a, IntT factor, FixedFrac& out) noexcept;
+        /// @return `Overflow` if the numerator is the minimum of `IntT`.
+        static constexpr FracError tryNegate(const FixedFrac& a, FixedFrac& out) noexcept;
+
+    public: // BATCH FUNCTIONS
+        // Every function writes `out[i] = a[i] op b[i]` (or `a[i] op scalar`) for `count` elements and
+        // returns the number of elements that overflowed, which hold `0`. `out` may be `a` or `b`.
+        // Overflow is detected without branches, so the loops vectorize.
+
+        /// @brief Element-wise `a + b`.
+        /// @example std::size_t failed = FixedFrac<100>::add(prices, fees, totals, count);
+        static constexpr std::size_t add(const FixedFrac* a, const FixedFrac* b, FixedFrac* out, std::size_t count) noexcept;
+        /// @brief Adds `scalar` to every element of `a`.
+        static constexpr std::size_t add(const FixedFrac* a, FixedFrac scalar, FixedFrac* out, std::size_t count) noexcept;
+        /// @brief Element-wise `a - b`.
+        static constexpr std::size_t sub(const FixedFrac* a, const FixedFrac* b, FixedFrac* out, std::size_t count) noexcept;
+        /// @brief Subtracts `scalar` from every element of `a`.
+        static constexpr std::size_t sub(const FixedFrac* a, FixedFrac scalar, FixedFrac* out, std::size_t count) noexcept;
+        /// @brief Sum of `count` values. Intermediate sums may leave the range of `IntT` as long as the
+        /// total does not.
+        /// @return `Overflow` if the total does not fit in `IntT`.
+        static constexpr FracError trySum(const FixedFrac* values, std::size_t count, FixedFrac& out) noexcept;
+
+    private: // PRIVATE FUNCTIONS
+        using Unsigned = typename detail::IntTraits<IntT>::Unsigned;
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        using TryOp = FracError (*)(const FixedFrac&, const FixedFrac&, FixedFrac&) noexcept;
+
+        /// @brief Runs a `try*` function and raises its error.
+        static constexpr FixedFrac apply(TryOp op, const FixedFrac& a, const FixedFrac& b);
+        static constexpr FixedFrac scale(const FixedFrac& a, IntT factor);
+        /// @brief Wrapping `a + b` (or `a - b`), and whether it overflowed, computed without branches.
+        static constexpr IntT addWrapping(IntT a, IntT b, bool isSubtracting, bool& isOverflow) noexcept;
+        /// @brief Ticks of `frac`: `frac * Den` split into a quotient and a remainder with the sign of `frac`.
+        /// @return `ZeroDivisor` for a zero denominator, `Overflow` if an intermediate value does not fit.
+        static constexpr FracError divideTicks(const BasicFrac<IntT>& frac, Wide& quotient, Wide& remainder, Wide& divisor) noexcept;
+
+    private: // ATTRIBUTES
+        IntT tickCount;
+    };
+
+    /// @brief Fixed-denominator fraction with a 64-bit numerator.
+    template <std::int64_t Den>
+    using FixedFrac64 = FixedFrac<Den, std::int64_t>;
+
+    static_assert(sizeof(FixedFrac<100>) == sizeof(int) && std::is_trivially_copyable<FixedFrac<100>>::value,
+        "FixedFrac must stay the size of its numerator and trivially copyable.");
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    template <typename T, typename>
+    constexpr FixedFrac<Den, IntT>::FixedFrac(T n) : tickCount(0) {
+        detail::throwOnError(tryMake(n, *this));
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT>::FixedFrac(const BasicFrac<IntT>& frac) : tickCount(0) {
+        detail::throwOnError(tryConvert(frac, *this));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT>& FixedFrac<Den, IntT>::operator+=(const FixedFrac& other) {
+        detail::throwOnError(tryAdd(*this, other, *this));
+        return *this;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT>& FixedFrac<Den, IntT>::operator-=(const FixedFrac& other) {
+        detail::throwOnError(trySub(*this, other, *this));
+        return *this;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT>& FixedFrac<Den, IntT>::operator*=(IntT factor) {
+        detail::throwOnError(tryMul(*this, factor, *this));
+        return *this;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT> FixedFrac<Den, IntT>::operator-() const {
+        FixedFrac result;
+        detail::throwOnError(tryNegate(*this, result));
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    constexpr BasicFrac<IntT> FixedFrac<Den, IntT>::value() const noexcept {
+        // `gcd(0, Den)` is `Den`, so zero becomes 0/1
+        const IntT gcd = detail::gcdOf(this->tickCount, DENOMINATOR);
+        BasicFrac<IntT> result;
+        result.numerator = static_cast<IntT>(this->tickCount / gcd);
+        result.denominator = static_cast<IntT>(DENOMINATOR / gcd);
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Non-Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    template <typename T, typename>
+    constexpr FracError FixedFrac<Den, IntT>::tryMake(T n, FixedFrac& out) noexcept {
+        IntT ticks = 0;
+        if (!detail::fitsIn<IntT>(n) || detail::mulOverflow(static_cast<IntT>(n), DENOMINATOR, ticks)) {
+            return FracError::Overflow;
+        }
+        out.tickCount = ticks;
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::tryConvert(const BasicFrac<IntT>& frac, FixedFrac& out) noexcept {
+        Wide quotient = 0, remainder = 0, divisor = 0;
+        const FracError error = divideTicks(frac, quotient, remainder, divisor);
+        if (error != FracError::None) return error;
+        if (remainder != 0) return FracError::Inexact;
+        if (!detail::fitsIn<IntT>(quotient)) return FracError::Overflow;
+        out.tickCount = static_cast<IntT>(quotient);
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::tryRound(const BasicFrac<IntT>& frac, FixedFrac& out) noexcept {
+        Wide quotient = 0, remainder = 0, divisor = 0;
+        const FracError error = divideTicks(frac, quotient, remainder, divisor);
+        if (error != FracError::None) return error;
+
+        // Halfway or beyond when 2 * |remainder| >= divisor, compared as |remainder| >= divisor - |remainder|
+        const Wide magnitude = remainder < 0 ? -remainder : remainder;
+        if (magnitude >= divisor - magnitude) {
+            if (remainder < 0 ? detail::subOverflow(quotient, static_cast<Wide>(1), quotient) :
+                detail::addOverflow(quotient, static_cast<Wide>(1), quotient)) {
+                return FracError::Overflow;
+            }
+        }
+        if (!detail::fitsIn<IntT>(quotient)) return FracError::Overflow;
+        out.tickCount = static_cast<IntT>(quotient);
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::tryAdd(const FixedFrac& a, const FixedFrac& b, FixedFrac& out) noexcept {
+        IntT sum = 0;
+        if (detail::addOverflow(a.tickCount, b.tickCount, sum)) return FracError::Overflow;
+        out.tickCount = sum;
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::trySub(const FixedFrac& a, const FixedFrac& b, FixedFrac& out) noexcept {
+        IntT difference = 0;
+        if (detail::subOverflow(a.tickCount, b.tickCount, difference)) return FracError::Overflow;
+        out.tickCount = difference;
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::tryMul(const FixedFrac& a, IntT factor, FixedFrac& out) noexcept {
+        IntT product = 0;
+        if (detail::mulOverflow(a.tickCount, factor, product)) return FracError::Overflow;
+        out.tickCount = product;
+        return FracError::None;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::tryNegate(const FixedFrac& a, FixedFrac& out) noexcept {
+        IntT negated = 0;
+        if (detail::subOverflow(static_cast<IntT>(0), a.tickCount, negated)) return FracError::Overflow;
+        out.tickCount = negated;
+        return FracError::None;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Batch Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    constexpr std::size_t FixedFrac<Den, IntT>::add(const FixedFrac* a, const FixedFrac* b, FixedFrac* out, std::size_t count) noexcept {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            bool isOverflow = false;
+            const IntT sum = addWrapping(a[i].tickCount, b[i].tickCount, false, isOverflow);
+            out[i].tickCount = isOverflow ? static_cast<IntT>(0) : sum;
+            failures += isOverflow;
+        }
+        return failures;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr std::size_t FixedFrac<Den, IntT>::add(const FixedFrac* a, FixedFrac scalar, FixedFrac* out, std::size_t count) noexcept {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            bool isOverflow = false;
+            const IntT sum = addWrapping(a[i].tickCount, scalar.tickCount, false, isOverflow);
+            out[i].tickCount = isOverflow ? static_cast<IntT>(0) : sum;
+            failures += isOverflow;
+        }
+        return failures;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr std::size_t FixedFrac<Den, IntT>::sub(const FixedFrac* a, const FixedFrac* b, FixedFrac* out, std::size_t count) noexcept {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            bool isOverflow = false;
+            const IntT difference = addWrapping(a[i].tickCount, b[i].tickCount, true, isOverflow);
+            out[i].tickCount = isOverflow ? static_cast<IntT>(0) : difference;
+            failures += isOverflow;
+        }
+        return failures;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr std::size_t FixedFrac<Den, IntT>::sub(const FixedFrac* a, FixedFrac scalar, FixedFrac* out, std::size_t count) noexcept {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            bool isOverflow = false;
+            const IntT difference = addWrapping(a[i].tickCount, scalar.tickCount, true, isOverflow);
+            out[i].tickCount = isOverflow ? static_cast<IntT>(0) : difference;
+            failures += isOverflow;
+        }
+        return failures;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::trySum(const FixedFrac* values, std::size_t count, FixedFrac& out) noexcept {
+        if constexpr (detail::IntTraits<IntT>::isWidened) {
+            // Blocks of 2^16 values cannot overflow the widened type, which has at least 32 more bits
+            constexpr std::size_t BLOCK = std::size_t(1) << 16;
+            Wide total = 0;
+            for (std::size_t first = 0; first < count; first += BLOCK) {
+                const std::size_t last = count - first < BLOCK ? count : first + BLOCK;
+                Wide block = 0;
+                for (std::size_t i = first; i < last; i++) block += values[i].tickCount;
+                if (detail::addOverflow(total, block, total)) return FracError::Overflow;
+            }
+            if (!detail::fitsIn<IntT>(total)) return FracError::Overflow;
+            out.tickCount = static_cast<IntT>(total);
+        } else {
+            IntT total = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                if (detail::addOverflow(total, values[i].tickCount, total)) return FracError::Overflow;
+            }
+            out.tickCount = total;
+        }
+        return FracError::None;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT> FixedFrac<Den, IntT>::apply(TryOp op, const FixedFrac& a, const FixedFrac& b) {
+        FixedFrac result;
+        detail::throwOnError(op(a, b, result));
+        return result;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FixedFrac<Den, IntT> FixedFrac<Den, IntT>::scale(const FixedFrac& a, IntT factor) {
+        FixedFrac result;
+        detail::throwOnError(tryMul(a, factor, result));
+        return result;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr IntT FixedFrac<Den, IntT>::addWrapping(IntT a, IntT b, bool isSubtracting, bool& isOverflow) noexcept {
+        // Two's complement overflow: the result has the wrong sign for the operands
+        const Unsigned bits = isSubtracting ? static_cast<Unsigned>(static_cast<Unsigned>(a) - static_cast<Unsigned>(b)) :
+            static_cast<Unsigned>(static_cast<Unsigned>(a) + static_cast<Unsigned>(b));
+        const IntT result = static_cast<IntT>(bits);
+        isOverflow = (isSubtracting ? ((a ^ b) & (a ^ result)) : ((a ^ result) & (b ^ result))) < 0;
+        return result;
+    }
+
+    template <std::int64_t Den, typename IntT>
+    constexpr FracError FixedFrac<Den, IntT>::divideTicks(const BasicFrac<IntT>& frac, Wide& quotient, Wide& remainder, Wide& divisor) noexcept {
+        if (frac.denominator == 0) {
+            return FracError::ZeroDivisor;
+        }
+        Wide ticks = 0;
+        if (detail::mulWide(frac.numerator, DENOMINATOR, ticks)) {
+            return FracError::Overflow;
+        }
+        divisor = frac.denominator;
+        if (divisor < 0 && (detail::subOverflow(static_cast<Wide>(0), ticks, ticks) || detail::subOverflow(static_cast<Wide>(0), divisor, divisor))) {
+            return FracError::Overflow;
+        }
+        quotient = ticks / divisor;
+        remainder = ticks % divisor;
+        return FracError::None;
+    }
+}
+
+namespace std {
+    /// @brief Hashes fixed-denominator fractions by value, consistently with `std::hash<BasicFrac<IntT>>`.
+    template <std::int64_t Den, typename IntT>
+    struct hash<FracLib::FixedFrac<Den, IntT>> {
+        std::size_t operator()(const FracLib::FixedFrac<Den, IntT>& frac) const noexcept { return frac.hash(); }
+    };
+}
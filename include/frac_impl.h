@@ -0,0 +1,697 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_impl.h
+ * Description:
+ *  This header file implements the non-core parts of the `BasicFrac` class template:
+ *  decimal and string conversions, the decimal/string operator overloads,
+ *  stream insertion/extraction and the string parser.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by `frac.h`
+ *  so any `BasicFrac<IntT>` can be instantiated. Otherwise `src/frac.cpp`
+ *  explicitly instantiates `Frac`, `Frac64` and `Frac128` into the static
+ *  library and `frac.h` declares those instantiations `extern`.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <istream>
+#include <ostream>
+#include <string>
+#include <cmath>
+#include <cstdint>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <charconv>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Writes an integer in base 10, like `std::to_chars`. Also handles 128-bit values,
+        /// which the standard library only supports in some modes.
+        template <typename T>
+        std::to_chars_result writeDecimal(char* first, char* last, T value) noexcept {
+            if constexpr (sizeof(T) <= sizeof(long long)) {
+                return std::to_chars(first, last, value);
+            } else {
+                char buffer[48];
+                char* end = buffer + sizeof(buffer);
+                char* p = end;
+                auto magnitude = absToUnsigned(value);
+                do {
+                    *--p = static_cast<char>('0' + static_cast<int>(magnitude % 10));
+                    magnitude /= 10;
+                } while (magnitude != 0);
+                if (value < 0) *--p = '-';
+
+                const std::size_t length = static_cast<std::size_t>(end - p);
+                if (static_cast<std::size_t>(last - first) < length) {
+                    return {last, std::errc::value_too_large};
+                }
+                std::memcpy(first, p, length);
+                return {first + length, std::errc()};
+            }
+        }
+
+        /// @brief Writes a single character, like `std::to_chars`.
+        inline std::to_chars_result writeChar(char* first, char* last, char ch) noexcept {
+            if (first == last) return {last, std::errc::value_too_large};
+            *first = ch;
+            return {first + 1, std::errc()};
+        }
+
+        /// @brief Number of bits needed to represent `value` (0 for 0).
+        inline int bitWidth(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return value == 0 ? 0 : 64 - __builtin_clzll(value);
+#else
+            int width = 0;
+            for (; value != 0; value >>= 1) width++;
+            return width;
+#endif
+        }
+
+        /// @brief A finite double split into `(-1)^isNegative * mantissa * 2^exponent`, with an odd mantissa
+        /// (or zero) so the fraction it describes is already in lowest terms.
+        struct DyadicParts {
+            std::uint64_t mantissa;
+            int exponent;
+            bool isNegative;
+        };
+
+        /// @brief Reads the IEEE 754 sign, exponent and significand bits of a finite double.
+        inline DyadicParts decomposeDouble(double value) noexcept {
+            static_assert(sizeof(double) == sizeof(std::uint64_t), "double must be IEEE 754 binary64");
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            DyadicParts parts{bits & ((std::uint64_t(1) << 52) - 1), 0, (bits >> 63) != 0};
+            const int biased = static_cast<int>((bits >> 52) & 0x7FF);
+            if (biased == 0) {
+                parts.exponent = -1074; // subnormal, no implicit leading one
+            } else {
+                parts.mantissa |= std::uint64_t(1) << 52;
+                parts.exponent = biased - 1075;
+            }
+            if (parts.mantissa != 0) {
+                const int zeros = countTrailingZeros(parts.mantissa);
+                parts.mantissa >>= zeros;
+                parts.exponent += zeros;
+            }
+            return parts;
+        }
+
+#ifdef FRACLIB_HAS_INT128
+        using ApproxUnsigned = unsigned __int128;
+        /// @brief Largest power of two used as the denominator of the exact value before approximating.
+        constexpr int APPROX_MAX_SHIFT = 126;
+#else
+        using ApproxUnsigned = std::uint64_t;
+        constexpr int APPROX_MAX_SHIFT = 62;
+#endif
+
+        /// @brief Largest `k` such that `base + k * step <= limit` (`base <= limit`), unbounded when `step` is 0.
+        template <typename UnsignedT>
+        inline UnsignedT stepsWithin(UnsignedT base, UnsignedT step, UnsignedT limit) noexcept {
+            return step == 0 ? ~static_cast<UnsignedT>(0) : (limit - base) / step;
+        }
+
+        /// @brief Best rational approximation `p/q` of `numerator / denominator` with `p <= maxNumerator` and
+        /// `q <= maxDenominator`, found by walking the continued fraction expansion (Stern-Brocot descent)
+        /// and choosing between the last convergent and the last semiconvergent that fit.
+        template <typename UnsignedT>
+        inline void bestApproximation(UnsignedT numerator, UnsignedT denominator, UnsignedT maxNumerator,
+            UnsignedT maxDenominator, UnsignedT& p, UnsignedT& q) noexcept {
+            UnsignedT p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+            UnsignedT n = numerator, d = denominator;
+            while (d != 0) {
+                // Most partial quotients are 1, which needs no division
+                const UnsignedT a = n < d ? 0 : (n - d < d ? 1 : n / d);
+                // Same test as `a > stepsWithin(...)`, with multiplications instead of divisions
+                UnsignedT p2 = 0, q2 = 0;
+                if (mulOverflow(a, q1, q2) || addOverflow(q0, q2, q2) || q2 > maxDenominator ||
+                    mulOverflow(a, p1, p2) || addOverflow(p0, p2, p2) || p2 > maxNumerator) break;
+                p0 = p1; q0 = q1;
+                p1 = p2; q1 = q2;
+                const UnsignedT r = n - a * d;
+                n = d;
+                d = r;
+            }
+            if (d == 0) { // expansion terminated, the value itself fits
+                p = p1;
+                q = q1;
+                return;
+            }
+
+            // Semiconvergent (p0 + k*p1) / (q0 + k*q1) with the largest k that fits. With the remaining complete
+            // quotient alpha = n/d, the convergent p1/q1 is at least as close iff (q0 + k*q1) <= q1 * (alpha - k).
+            const UnsignedT kDenominator = stepsWithin(q0, q1, maxDenominator);
+            const UnsignedT kNumerator = stepsWithin(p0, p1, maxNumerator);
+            const UnsignedT k = kDenominator < kNumerator ? kDenominator : kNumerator;
+            const UnsignedT semiDenominator = q0 + k * q1;
+            UnsignedT lhs = 0, rhs = 0;
+            bool isConvergentCloser = false;
+            if (!mulOverflow(semiDenominator, d, lhs) && !mulOverflow(q1, static_cast<UnsignedT>(n - k * d), rhs)) {
+                isConvergentCloser = lhs <= rhs;
+            } else {
+                const long double alpha = static_cast<long double>(n) / static_cast<long double>(d);
+                isConvergentCloser = static_cast<long double>(semiDenominator) <= static_cast<long double>(q1) * (alpha - static_cast<long double>(k));
+            }
+            if (isConvergentCloser) {
+                p = p1;
+                q = q1;
+            } else {
+                p = p0 + k * p1;
+                q = semiDenominator;
+            }
+        }
+
+        /// @brief Batch simplification kernel of `Frac::SimplifyBatch` and `FracArray::simplifyAll`
+        /// over separate numerator and denominator buffers (defined in `frac_kernels.h`).
+        FRACLIB_INLINE std::size_t simplifyBatch(int* numerators, int* denominators, std::size_t count, FracError* status) noexcept;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    BasicFrac<IntT>::BasicFrac(float decimal) : numerator(0), denominator(1) {
+        FRACLIB_COUNT(conversions, 1);
+        detail::throwOnError(tryFromFloat(decimal, *this));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operand Conversions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::fromOperand(float value) {
+        if (!detail::isCacheEnabled()) return BasicFrac(value);
+        using Cache = detail::ConversionCache<IntT>;
+        Cache& cache = detail::threadConversionCache<IntT>();
+        const typename Cache::Key key = Cache::makeKey(value);
+        BasicFrac result;
+        if (cache.find(key, result.numerator, result.denominator)) return result;
+        result = BasicFrac(value);
+        cache.insert(key, result.numerator, result.denominator);
+        return result;
+    }
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::fromOperand(const char* value) {
+        if (value == nullptr || !detail::isCacheEnabled()) return BasicFrac(value);
+        using Cache = detail::ConversionCache<IntT>;
+        Cache& cache = detail::threadConversionCache<IntT>();
+        typename Cache::Key key;
+        if (!cache.makeKey(value, key)) return BasicFrac(value);
+        BasicFrac result;
+        if (cache.find(key, result.numerator, result.denominator)) return result;
+        result = BasicFrac(value);
+        cache.insert(key, result.numerator, result.denominator);
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Basic Arithmetic Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator+(float value) const {
+        return *(this) + fromOperand(value);
+    };
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator+(const char* value) const {
+        return *(this) + fromOperand(value);
+    };
+    
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator-(float value) const {
+        return *(this) - fromOperand(value);
+    };
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator-(const char* value) const {
+        return *(this) - fromOperand(value);
+    };
+    
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator*(float value) const {
+        return *(this) * fromOperand(value);
+    };
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator*(const char* value) const {
+        return *(this) * fromOperand(value);
+    };
+    
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator/(float value) const {
+        return *(this) / fromOperand(value);
+    };
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::operator/(const char* value) const {
+        return *(this) / fromOperand(value);
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Compound Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator+=(float value) {
+        (*this) = *(this) + fromOperand(value);
+        return *this;
+    }
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator+=(const char* value) {
+        (*this) = *(this) + fromOperand(value);
+        return *this;
+    }
+
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator-=(float value) {
+        (*this) = *(this) - fromOperand(value);
+        return *this;
+    }
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator-=(const char* value) {
+        (*this) = *(this) - fromOperand(value);
+        return *this;
+    }
+    
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator*=(float value) {
+        (*this) = *(this) * fromOperand(value);
+        return *this;
+    }
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator*=(const char* value) {
+        (*this) = *(this) * fromOperand(value);
+        return *this;
+    }
+    
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator/=(float value) {
+        (*this) = *(this) / fromOperand(value);
+        return *this;
+    }
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator/=(const char* value) {
+        (*this) = *(this) / fromOperand(value);
+        return *this;
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Comparision Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator==(float other) const {
+        return (*this == fromOperand(other));
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator==(const char* other) const {
+        return (*this == fromOperand(other));
+    }
+
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator!=(float other) const {
+        return !(*this == fromOperand(other));  // implement != by negating ==
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator!=(const char* other) const {
+        return !(*this == fromOperand(other));  // implement != by negating ==
+    }
+
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator>=(float other) const {
+        return (*this >= fromOperand(other));
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator>=(const char* other) const {
+        return (*this >= fromOperand(other));
+    }
+
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator<=(float other) const {
+        return (*this <= fromOperand(other));
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator<=(const char* other) const {
+        return (*this <= fromOperand(other));
+    }
+
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator>(float other) const {
+        return (*this > fromOperand(other));
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator>(const char* other) const {
+        return (*this > fromOperand(other));
+    }
+
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator<(float other) const {
+        return (*this < fromOperand(other));
+    }
+    template <typename IntT>
+    bool BasicFrac<IntT>::operator<(const char* other) const {
+        return (*this < fromOperand(other));
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Misc Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    std::ostream& BasicFrac<IntT>::writeToStream(std::ostream& os, const BasicFrac& frac) {
+        // Formatted once into a stack buffer, which also covers 128-bit values that streams have no overload for
+        char buffer[MAX_CHARS];
+        const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), frac);
+        os.write(buffer, result.ptr - buffer);
+        return os;
+    }
+
+    template <typename IntT>
+    std::istream& BasicFrac<IntT>::readFromStream(std::istream& is, BasicFrac& frac){
+        std::string input;
+
+        // Read the entire input
+        std::getline(is, input);
+
+        // Trim any leading/trailing whitespace
+        input.erase(input.find_last_not_of(" \t\n\r\f\v") + 1);
+        input.erase(0, input.find_first_not_of(" \t\n\r\f\v"));
+
+        // Check if the input is empty or invalid
+        if (input.empty() || (!std::isdigit(input[0]) && input[0] != '-')) {
+            is.setstate(std::ios::failbit);
+            detail::raise(FracError::InvalidString,
+                "Invalid format: use decimal (0.5, 1.2) or string fractions (1/2, 2 1/2).");
+        }
+
+        // Attempt to parse string and convert to Frac object
+        FracError error = tryParse(input, frac);
+
+        // Attempt to parse as a decimal and convert to Frac object
+        if (error == FracError::InvalidString) {
+            error = tryParseDecimal(input, frac);
+        }
+
+        if (error != FracError::None) {
+            is.setstate(std::ios::failbit); // Mark stream as failed for invalid input
+            detail::raise(error);
+        }
+        return is;
+    }
+
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator=(const char* str){
+        detail::throwOnError(tryParse(str, *this));
+        return *this;
+    }
+
+    template <typename IntT>
+    BasicFrac<IntT>& BasicFrac<IntT>::operator=(float decimal){
+        detail::throwOnError(tryFromFloat(decimal, *this));
+        return *this;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    std::size_t BasicFrac<IntT>::SimplifyBatch(BasicFrac* data, std::size_t count, FracError* status) noexcept {
+        if constexpr (std::is_same<IntT, int>::value) {
+            // Repacked into separate buffers a block at a time for the SIMD kernel
+            constexpr std::size_t BLOCK = 256;
+            int numerators[BLOCK];
+            int denominators[BLOCK];
+            std::size_t failures = 0;
+            for (std::size_t first = 0; first < count; first += BLOCK) {
+                const std::size_t size = count - first < BLOCK ? count - first : BLOCK;
+                for (std::size_t i = 0; i < size; i++) {
+                    numerators[i] = data[first + i].numerator;
+                    denominators[i] = data[first + i].denominator;
+                }
+                failures += detail::simplifyBatch(numerators, denominators, size, status != nullptr ? status + first : nullptr);
+                for (std::size_t i = 0; i < size; i++) {
+                    data[first + i].numerator = numerators[i];
+                    data[first + i].denominator = denominators[i];
+                }
+            }
+            return failures;
+        } else {
+            std::size_t failures = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                const FracError error = trySimplify(data[i]);
+                if (status != nullptr) status[i] = error;
+                if (error != FracError::None) failures++;
+            }
+            return failures;
+        }
+    }
+
+    template <typename IntT>
+    std::string BasicFrac<IntT>::toString(const BasicFrac& frac){
+        char buffer[MAX_CHARS];
+        const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), frac);
+        return std::string(buffer, result.ptr);
+    }
+
+    template <typename IntT>
+    std::to_chars_result BasicFrac<IntT>::toChars(char* first, char* last, const BasicFrac& frac, bool isMixed) noexcept {
+        const std::to_chars_result result = writeChars(first, last, frac, isMixed);
+        FRACLIB_COUNT(formats, 1);
+        if (result.ec == std::errc()) FRACLIB_COUNT(formattedBytes, static_cast<std::uint64_t>(result.ptr - first));
+        return result;
+    }
+
+    template <typename IntT>
+    std::to_chars_result BasicFrac<IntT>::writeChars(char* first, char* last, const BasicFrac& frac, bool isMixed) noexcept {
+        std::to_chars_result result{first, std::errc()};
+        const auto numerator = detail::absToUnsigned(frac.numerator);
+        const auto denominator = detail::absToUnsigned(frac.denominator);
+
+        if (!isMixed || denominator == 0) {
+            result = detail::writeDecimal(first, last, frac.numerator);
+            if (result.ec == std::errc()) result = detail::writeChar(result.ptr, last, '/');
+            if (result.ec == std::errc()) result = detail::writeDecimal(result.ptr, last, frac.denominator);
+            return result;
+        }
+
+        // Mixed number: sign first, then the whole part, then the proper remainder (ie. "-3 1/2")
+        const auto whole = numerator / denominator;
+        const auto remainder = numerator % denominator;
+        if (frac.numerator != 0 && (frac.numerator < 0) != (frac.denominator < 0)) {
+            result = detail::writeChar(result.ptr, last, '-');
+        }
+        if (result.ec == std::errc() && (whole != 0 || remainder == 0)) {
+            result = detail::writeDecimal(result.ptr, last, whole);
+            if (remainder == 0 || result.ec != std::errc()) return result;
+            result = detail::writeChar(result.ptr, last, ' ');
+        }
+        if (result.ec == std::errc()) result = detail::writeDecimal(result.ptr, last, remainder);
+        if (result.ec == std::errc()) result = detail::writeChar(result.ptr, last, '/');
+        if (result.ec == std::errc()) result = detail::writeDecimal(result.ptr, last, denominator);
+        return result;
+    }
+
+    template <typename IntT>
+    FracWriteResult BasicFrac<IntT>::toCharsBulk(char* first, char* last, const BasicFrac* fracs, std::size_t count,
+        char separator, bool isMixed) noexcept {
+        char* p = first;
+        for (std::size_t i = 0; i < count; i++) {
+            std::to_chars_result result = toChars(p, last, fracs[i], isMixed);
+            if (result.ec == std::errc()) result = detail::writeChar(result.ptr, last, separator);
+            if (result.ec != std::errc()) {
+                return {p, i, std::errc::value_too_large};
+            }
+            p = result.ptr;
+        }
+        return {p, count, std::errc()};
+    }
+    
+    template <typename IntT>
+    BasicFrac<IntT> BasicFrac<IntT>::fromDouble(double value, IntT maxDenominator){
+        BasicFrac result;
+        detail::throwOnError(tryFromDouble(value, maxDenominator, result));
+        return result;
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::tryFromFloat(float decimal, BasicFrac& out) noexcept {
+        // Every float is exactly a double, and the best approximation within the full range is the exact value whenever it fits
+        return tryFromDouble(static_cast<double>(decimal), detail::IntTraits<IntT>::max, out);
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::tryFromDouble(double value, BasicFrac& out) noexcept {
+        if (!std::isfinite(value)) {
+            return FracError::NotFinite;
+        }
+        const detail::DyadicParts parts = detail::decomposeDouble(value);
+        if (parts.mantissa == 0) {
+            out.numerator = 0;
+            out.denominator = 1;
+            return FracError::None;
+        }
+
+        // mantissa * 2^exponent, so the exponent moves to the numerator or the denominator
+        constexpr int digits = detail::IntTraits<IntT>::digits;
+        const int mantissaBits = detail::bitWidth(parts.mantissa);
+        if (mantissaBits > digits || parts.exponent >= digits - mantissaBits + 1 || -parts.exponent >= digits) {
+            return FracError::Overflow;
+        }
+        using Unsigned = typename detail::IntTraits<IntT>::Unsigned;
+        const IntT magnitude = static_cast<IntT>(static_cast<Unsigned>(parts.mantissa) << (parts.exponent > 0 ? parts.exponent : 0));
+        out.numerator = parts.isNegative ? static_cast<IntT>(-magnitude) : magnitude;
+        out.denominator = static_cast<IntT>(static_cast<Unsigned>(1) << (parts.exponent < 0 ? -parts.exponent : 0));
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::tryFromDouble(double value, IntT maxDenominator, BasicFrac& out) noexcept {
+        if (!std::isfinite(value)) {
+            return FracError::NotFinite;
+        }
+        if (maxDenominator < 1) {
+            return FracError::ZeroDivisor;
+        }
+
+        // The exact value is representable, so it is also the best approximation
+        BasicFrac exact;
+        if (tryFromDouble(value, exact) == FracError::None && exact.denominator <= maxDenominator) {
+            out = exact;
+            return FracError::None;
+        }
+
+        detail::DyadicParts parts = detail::decomposeDouble(value);
+        if (parts.exponent >= 0) { // integer that does not fit
+            return FracError::Overflow;
+        }
+
+        // Very small values are rounded to 2^-APPROX_MAX_SHIFT, far below any step the bound allows
+        int shift = -parts.exponent;
+        if (shift < 64 && (parts.mantissa >> shift) > static_cast<std::uint64_t>(detail::absToUnsigned(detail::IntTraits<IntT>::max))) {
+            return FracError::Overflow; // whole part alone does not fit
+        }
+        if (shift > detail::APPROX_MAX_SHIFT) {
+            const int drop = shift - detail::APPROX_MAX_SHIFT;
+            parts.mantissa = drop >= 64 ? 0 : (parts.mantissa >> drop) + ((parts.mantissa >> (drop - 1)) & 1);
+            shift = detail::APPROX_MAX_SHIFT;
+        }
+
+        using detail::ApproxUnsigned;
+        const ApproxUnsigned denominator = static_cast<ApproxUnsigned>(1) << shift;
+        const ApproxUnsigned bound = static_cast<ApproxUnsigned>(maxDenominator) < denominator ? static_cast<ApproxUnsigned>(maxDenominator) : denominator;
+        ApproxUnsigned p = 0, q = 1;
+        detail::bestApproximation(static_cast<ApproxUnsigned>(parts.mantissa), denominator, static_cast<ApproxUnsigned>(detail::IntTraits<IntT>::max), bound, p, q);
+
+        if (!detail::fitsIn<IntT>(p) || !detail::fitsIn<IntT>(q) || q == 0) {
+            return FracError::Overflow;
+        }
+        out.numerator = parts.isNegative ? static_cast<IntT>(-static_cast<IntT>(p)) : static_cast<IntT>(p);
+        out.denominator = static_cast<IntT>(q);
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::tryLimitDenominator(const BasicFrac& value, IntT maxDenominator, BasicFrac& out) noexcept {
+        double error = 0;
+        return roundWide(value.numerator, value.denominator, maxDenominator, out, error);
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::roundWide(typename detail::IntTraits<IntT>::Wide n, typename detail::IntTraits<IntT>::Wide d,
+        IntT maxDenominator, BasicFrac& out, double& error) noexcept {
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        using WideUnsigned = typename detail::IntTraits<Wide>::Unsigned;
+        if (d == 0 || maxDenominator < 1) {
+            return FracError::ZeroDivisor;
+        }
+        if (n == 0) {
+            out.numerator = 0;
+            out.denominator = 1;
+            error = 0;
+            return FracError::None;
+        }
+
+        const bool isNegative = (n < 0) != (d < 0);
+        const WideUnsigned magnitude = detail::absToUnsigned(n);
+        const WideUnsigned divisor = detail::absToUnsigned(d);
+        const WideUnsigned maxNumerator = static_cast<WideUnsigned>(detail::IntTraits<IntT>::max);
+        if (detail::countOverflow(magnitude / divisor > maxNumerator)) {
+            return FracError::Overflow; // whole part alone does not fit
+        }
+        if (divisor <= static_cast<WideUnsigned>(maxDenominator)) {
+            // Exact within the bound, only lowest terms are left. One remainder brings the GCD to the width of `IntT`.
+            using Unsigned = typename detail::IntTraits<IntT>::Unsigned;
+            const WideUnsigned gcd = detail::gcd(static_cast<Unsigned>(magnitude % divisor), static_cast<Unsigned>(divisor));
+            if (magnitude / gcd <= maxNumerator) {
+                out.numerator = isNegative ? static_cast<IntT>(-static_cast<IntT>(magnitude / gcd)) : static_cast<IntT>(magnitude / gcd);
+                out.denominator = static_cast<IntT>(divisor / gcd);
+                error = 0;
+                return FracError::None;
+            }
+        }
+        WideUnsigned p = 0, q = 0;
+        detail::bestApproximation(magnitude, divisor, maxNumerator, static_cast<WideUnsigned>(maxDenominator), p, q);
+
+        // |n/d - p/q| = |n*q - p*d| / (d*q). The difference is below d*q, and below d when the denominator bound
+        // decided p/q, so it is exact in wrapping arithmetic whenever it is small enough to not wrap.
+        const long double estimate = static_cast<long double>(magnitude) / static_cast<long double>(divisor) -
+            static_cast<long double>(p) / static_cast<long double>(q);
+        const long double scale = static_cast<long double>(divisor) * static_cast<long double>(q);
+        const long double limit = static_cast<long double>(~static_cast<WideUnsigned>(0) >> 2);
+        if ((estimate < 0 ? -estimate : estimate) * scale < limit) {
+            WideUnsigned difference = static_cast<WideUnsigned>(magnitude * q - p * divisor);
+            if (difference > (~static_cast<WideUnsigned>(0) >> 1)) difference = static_cast<WideUnsigned>(0) - difference;
+            error = static_cast<double>(static_cast<long double>(difference) / scale);
+        } else {
+            error = static_cast<double>(estimate < 0 ? -estimate : estimate);
+        }
+        out.numerator = isNegative ? static_cast<IntT>(-static_cast<IntT>(p)) : static_cast<IntT>(p);
+        out.denominator = static_cast<IntT>(q);
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    FracError BasicFrac<IntT>::tryParseDecimal(std::string_view str, BasicFrac& out){
+        FRACLIB_COUNT(parses, 1);
+        FRACLIB_COUNT(parsedBytes, str.size());
+        // Exact whenever the value fits, which covers exponent notation too
+        if (parseExactDecimal(str, out) == FracError::None) {
+            return FracError::None;
+        }
+
+        // Too many digits or not a plain decimal, convert what the double holds. strtod needs a terminated
+        // copy, kept on the stack unless the text is unusually long.
+        if (str.empty()) return FracError::InvalidString;
+        char buffer[64];
+        std::string longText;
+        char* text = buffer;
+        if (str.size() < sizeof(buffer)) {
+            std::memcpy(buffer, str.data(), str.size());
+            buffer[str.size()] = '\0';
+        } else {
+            longText.assign(str);
+            text = longText.data();
+        }
+        char* end = nullptr;
+        const double value = std::strtod(text, &end);
+        if (end != text + str.size()) {
+            return FracError::InvalidString;
+        }
+        return tryFromDouble(value, detail::IntTraits<IntT>::max, out);
+    }
+}
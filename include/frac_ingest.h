@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_ingest.h
+ * Description:
+ *  This header file defines `ingest` and `ingestFile`, which load text with
+ *  one fraction per line into `FracArray` batches.
+ *
+ *  The input is cut into chunks of about `INGEST_CHUNK_SIZE` bytes that end
+ *  on a line boundary. Every round parses up to one chunk per thread, each
+ *  on its own `std::thread`, with `Frac::tryParse` and
+ *  `Frac::tryParseDecimal` straight from the text, so lines are never
+ *  copied into strings or streams. The batches of a round are handed to the
+ *  caller in input order before the next round starts, so a file is read
+ *  with memory for one round only. Lines that do not parse are left out of
+ *  the batch and reported with their line number.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_array.h"
+#include "frac_parallel.h"
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+namespace FracLib {
+    /// @brief Default size of one chunk in bytes.
+    constexpr std::size_t INGEST_CHUNK_SIZE = 1 << 20;
+
+    /// @brief A line that could not be read as a fraction.
+    struct FracLineError {
+        std::size_t line;   ///< 1-based line number in the input.
+        FracError error;    ///< `InvalidString`, `ZeroDivisor` or `Overflow`.
+    };
+
+    /// @brief The fractions of one chunk of the input, in input order.
+    struct FracBatch {
+        FracArray values;                   ///< Every line of the chunk that parsed, blank lines skipped.
+        std::size_t firstLine = 1;          ///< 1-based line number of the first line of the chunk.
+        std::size_t lineCount = 0;          ///< Lines in the chunk, including blank and failed ones.
+        std::vector<FracLineError> errors;  ///< Lines of the chunk that failed, in order.
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Reads one line (without its '\n') as `operator>>` would: surrounding blanks are trimmed,
+        /// then it is parsed as a fraction ("3/4", "1 1/2") or, failing that, as a decimal ("0.75", "1e-3").
+        FracError parseLine(std::string_view line, Frac& out);
+
+        /// @brief Replaces the contents of `batch` with the lines of `chunk`, numbering them from 1.
+        void parseChunk(std::string_view chunk, FracBatch& batch);
+
+        /// @brief Cuts `text` into newline-aligned chunks of about `chunkSize` bytes and parses them into
+        /// `batches` (resized to the number of chunks), one thread per chunk.
+        void parseRound(std::string_view text, std::size_t firstLine, std::size_t chunkSize, std::vector<FracBatch>& batches);
+
+        /// @brief Length of the longest prefix of `text` that holds at most `limit` bytes and ends after a
+        /// '\n'. A line longer than `limit` is taken whole, and text without a final '\n' is taken to its end.
+        inline std::size_t roundLength(std::string_view text, std::size_t limit) noexcept {
+            if (text.size() <= limit) return text.size();
+            std::size_t newline = text.rfind('\n', limit - 1);
+            if (newline == std::string_view::npos) newline = text.find('\n', limit);
+            return newline == std::string_view::npos ? text.size() : newline + 1;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Ingestion
+    //\\\\\\\\\\\\\\\\\\\\/
+    // `onBatch(FracBatch&)` is called on the calling thread once per chunk, in input order, and may move
+    // the values out of the batch. `threads` is the number of threads to use, `0` for one per hardware
+    // thread. `chunkSize` is the target number of bytes per batch.
+
+    /// @brief Parses `text`, one fraction per line, and hands the results to `onBatch` chunk by chunk.
+    /// @return the error of the first line that failed, or `FracError::None`. Every line is still read.
+    /// @example FracLib::ingest(text, [&](FracLib::FracBatch& batch) { process(batch.values); });
+    template <typename BatchFn>
+    FracError ingest(std::string_view text, BatchFn onBatch, unsigned threads = 0, std::size_t chunkSize = INGEST_CHUNK_SIZE) {
+        if (chunkSize == 0) chunkSize = 1;
+        const std::size_t limit = chunkSize * detail::threadCount(threads);
+        FracError result = FracError::None;
+        std::size_t line = 1;
+        std::vector<FracBatch> batches;
+        while (!text.empty()) {
+            const std::size_t length = detail::roundLength(text, limit);
+            detail::parseRound(text.substr(0, length), line, chunkSize, batches);
+            for (FracBatch& batch : batches) {
+                if (result == FracError::None && !batch.errors.empty()) result = batch.errors.front().error;
+                line += batch.lineCount;
+                onBatch(batch);
+            }
+            text.remove_prefix(length);
+        }
+        return result;
+    }
+
+    /// @brief Reads the file at `path` one round at a time and parses it like `ingest`.
+    /// @return `FracError::IoError` if the file cannot be opened or read (batches already handed over stay
+    /// valid), otherwise the error of the first line that failed or `FracError::None`.
+    /// @example FracLib::ingestFile("prices.txt", [&](FracLib::FracBatch& batch) { process(batch.values); });
+    template <typename BatchFn>
+    FracError ingestFile(const char* path, BatchFn onBatch, unsigned threads = 0, std::size_t chunkSize = INGEST_CHUNK_SIZE) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return FracError::IoError;
+        if (chunkSize == 0) chunkSize = 1;
+        const std::size_t limit = chunkSize * detail::threadCount(threads);
+
+        FracError result = FracError::None;
+        std::size_t line = 1;
+        std::vector<char> buffer;
+        std::vector<FracBatch> batches;
+        std::size_t kept = 0; // bytes of an unfinished line carried over from the previous read
+        bool isAtEnd = false;
+        while (!isAtEnd) {
+            buffer.resize(kept + limit);
+            file.read(buffer.data() + kept, static_cast<std::streamsize>(limit));
+            if (file.bad()) return FracError::IoError;
+            isAtEnd = file.eof();
+            const std::string_view text(buffer.data(), kept + static_cast<std::size_t>(file.gcount()));
+
+            // Only whole lines are parsed, unless the file ends without a '\n'
+            const std::size_t newline = text.rfind('\n');
+            std::size_t length = text.size();
+            if (!isAtEnd) length = newline == std::string_view::npos ? 0 : newline + 1;
+            if (length > 0) {
+                detail::parseRound(text.substr(0, length), line, chunkSize, batches);
+                for (FracBatch& batch : batches) {
+                    if (result == FracError::None && !batch.errors.empty()) result = batch.errors.front().error;
+                    line += batch.lineCount;
+                    onBatch(batch);
+                }
+            }
+            kept = text.size() - length;
+            std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(length), buffer.begin() + static_cast<std::ptrdiff_t>(text.size()), buffer.begin());
+        }
+        return result;
+    }
+
+    /// @brief Parses `text` into `out`, replacing its contents.
+    /// @param errors receives every line that failed, when not null.
+    /// @return the error of the first line that failed, or `FracError::None`.
+    /// @example FracArray values; std::vector<FracLineError> errors; FracLib::ingest(text, values, &errors);
+    FracError ingest(std::string_view text, FracArray& out, std::vector<FracLineError>* errors = nullptr, unsigned threads = 0);
+    /// @brief Reads the file at `path` into `out`, replacing its contents.
+    /// @return `FracError::IoError` if the file cannot be read (`out` is then unchanged), otherwise as `ingest`.
+    FracError ingestFile(const char* path, FracArray& out, std::vector<FracLineError>* errors = nullptr, unsigned threads = 0);
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_ingest.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_ingest_impl.h"
+#endif
@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_ingest_impl.h
+ * Description:
+ *  This header file implements the line parsing and the threaded rounds
+ *  behind `ingest` and `ingestFile` declared in `frac_ingest.h`.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by
+ *  `frac_ingest.h`. Otherwise `src/frac_ingest.cpp` compiles it into the
+ *  static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_ingest.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        FRACLIB_INLINE FracError parseLine(std::string_view line, Frac& out) {
+            constexpr std::string_view BLANKS = " \t\n\r\f\v";
+            const std::size_t first = line.find_first_not_of(BLANKS);
+            line = line.substr(first, line.find_last_not_of(BLANKS) + 1 - first);
+
+            // Same rules as `operator>>`: a fraction first, then a decimal
+            if (line[0] != '-' && (line[0] < '0' || line[0] > '9')) return FracError::InvalidString;
+            const FracError error = Frac::tryParse(line, out);
+            return error == FracError::InvalidString ? Frac::tryParseDecimal(line, out) : error;
+        }
+
+        FRACLIB_INLINE void parseChunk(std::string_view chunk, FracBatch& batch) {
+            batch.values.clear();
+            batch.errors.clear();
+            batch.lineCount = 0;
+            // Every line holds at most one value, reserving for all of them avoids regrowing
+            std::size_t lines = static_cast<std::size_t>(std::count(chunk.begin(), chunk.end(), '\n'));
+            if (!chunk.empty() && chunk.back() != '\n') lines++;
+            batch.values.reserve(lines);
+
+            constexpr std::string_view BLANKS = " \t\r\f\v";
+            while (!chunk.empty()) {
+                const std::size_t newline = chunk.find('\n');
+                const std::string_view line = chunk.substr(0, newline);
+                chunk.remove_prefix(newline == std::string_view::npos ? chunk.size() : newline + 1);
+                batch.lineCount++;
+                if (line.find_first_not_of(BLANKS) == std::string_view::npos) continue;
+
+                Frac value;
+                const FracError error = parseLine(line, value);
+                if (error == FracError::None) {
+                    batch.values.push_back(value);
+                } else {
+                    batch.errors.push_back(FracLineError{batch.lineCount, error});
+                }
+            }
+        }
+
+        FRACLIB_INLINE void parseRound(std::string_view text, std::size_t firstLine, std::size_t chunkSize, std::vector<FracBatch>& batches) {
+            std::vector<std::string_view> chunks;
+            while (!text.empty()) {
+                const std::size_t length = roundLength(text, chunkSize);
+                chunks.push_back(text.substr(0, length));
+                text.remove_prefix(length);
+            }
+            batches.resize(chunks.size());
+            runChunks(chunks.size(), [&chunks, &batches](std::size_t chunk) { parseChunk(chunks[chunk], batches[chunk]); });
+
+            // Chunk-relative line numbers become input line numbers
+            for (FracBatch& batch : batches) {
+                batch.firstLine = firstLine;
+                for (FracLineError& error : batch.errors) error.line += firstLine - 1;
+                firstLine += batch.lineCount;
+            }
+        }
+
+        /// @brief Appends every batch to `out` and its errors to `errors` when not null.
+        class BatchCollector {
+        public:
+            BatchCollector(FracArray& out, std::vector<FracLineError>* errors) noexcept : values(out), lineErrors(errors) {}
+
+            void operator()(FracBatch& batch) {
+                const std::size_t size = this->values.size();
+                this->values.resize(size + batch.values.size());
+                std::copy_n(batch.values.numerators(), batch.values.size(), this->values.numerators() + size);
+                std::copy_n(batch.values.denominators(), batch.values.size(), this->values.denominators() + size);
+                if (this->lineErrors != nullptr) {
+                    this->lineErrors->insert(this->lineErrors->end(), batch.errors.begin(), batch.errors.end());
+                }
+            }
+
+        private:
+            FracArray& values;
+            std::vector<FracLineError>* lineErrors;
+        };
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Ingestion
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracError ingest(std::string_view text, FracArray& out, std::vector<FracLineError>* errors, unsigned threads) {
+        FracArray values(out.resource());
+        std::vector<FracLineError> lineErrors;
+        const FracError error = ingest(text, detail::BatchCollector(values, errors != nullptr ? &lineErrors : nullptr), threads);
+        out = std::move(values);
+        if (errors != nullptr) *errors = std::move(lineErrors);
+        return error;
+    }
+
+    FRACLIB_INLINE FracError ingestFile(const char* path, FracArray& out, std::vector<FracLineError>* errors, unsigned threads) {
+        FracArray values(out.resource());
+        std::vector<FracLineError> lineErrors;
+        const FracError error = ingestFile(path, detail::BatchCollector(values, errors != nullptr ? &lineErrors : nullptr), threads);
+        if (error == FracError::IoError) return error;
+        out = std::move(values);
+        if (errors != nullptr) *errors = std::move(lineErrors);
+        return error;
+    }
+}
@@ -0,0 +1,953 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_inline.h
+ * Description:
+ *  This header file implements the core of the `BasicFrac` class template:
+ *  constructors, integer and fraction arithmetic, comparisons and
+ *  simplification. These members are `constexpr` and therefore implicitly
+ *  inline, which allows the compiler to constant-fold fraction literals and
+ *  keep hot arithmetic in registers without requiring link-time optimization.
+ *
+ *  Arithmetic computes cross products in the widened type named by
+ *  `detail::IntTraits<IntT>::Wide` and narrows the result back to `IntT` in
+ *  lowest terms, whether or not the operands were reduced. The arithmetic is
+ *  written once in the non-throwing `try*` functions, which return a
+ *  `FracError`; the operators forward to them and raise on failure.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_overflow.h"
+#include "frac_error.h"
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Number of trailing zero bits of a non-zero unsigned value.
+        template <typename U>
+        constexpr int countTrailingZeros(U value) {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (sizeof(U) <= sizeof(unsigned int)) {
+                return __builtin_ctz(static_cast<unsigned int>(value));
+            } else if constexpr (sizeof(U) <= sizeof(unsigned long long)) {
+                return __builtin_ctzll(static_cast<unsigned long long>(value));
+            } else {
+                const auto low = static_cast<unsigned long long>(value);
+                return low != 0 ? __builtin_ctzll(low) : 64 + __builtin_ctzll(static_cast<unsigned long long>(value >> 64));
+            }
+#else
+            int count = 0;
+            while ((value & 1) == 0) {
+                value >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        /// @brief Greatest common divisor of two magnitudes using the binary (Stein) algorithm.
+        /// Only shifts, compares and subtractions are used, no division. `gcd(0, b)` is `b`.
+        template <typename U>
+        constexpr U gcd(U a, U b) {
+            if (a == 0) return b;
+            if (b == 0) return a;
+
+            // Common factors of two are restored at the end
+            const int shift = countTrailingZeros(static_cast<U>(a | b));
+            a >>= countTrailingZeros(a);
+#ifdef FRACLIB_STATS
+            std::uint64_t iterations = 0;
+#endif
+            do {
+                b >>= countTrailingZeros(b);
+                if (a > b) {
+                    U temp = a;
+                    a = b;
+                    b = temp;
+                }
+                b -= a;
+#ifdef FRACLIB_STATS
+                iterations++;
+#endif
+            } while (b != 0);
+            FRACLIB_COUNT(gcdCalls, 1);
+            FRACLIB_COUNT(gcdIterations, iterations);
+            return static_cast<U>(a << shift);
+        }
+
+        /// @brief GCD of two signed values, returned as a value of the same type.
+        /// Returns 1 in the single case the GCD is not representable (both values are the minimum or zero),
+        /// which callers treat as "nothing to cancel".
+        template <typename T>
+        constexpr T gcdOf(T a, T b) {
+            const auto result = gcd(absToUnsigned(a), absToUnsigned(b));
+            return fitsIn<T>(result) && result != 0 ? static_cast<T>(result) : static_cast<T>(1);
+        }
+
+        /// @brief `gcdOf` for widened values. When `b` fits in `IntT`, one wide remainder brings `a` into
+        /// range and the binary GCD runs at the width of `IntT`.
+        template <typename IntT, typename WideT>
+        constexpr WideT gcdOfWide(WideT a, WideT b) {
+            if constexpr (IntTraits<IntT>::isWidened) {
+                if (b != 0 && fitsIn<IntT>(b)) {
+                    using Unsigned = typename IntTraits<IntT>::Unsigned;
+                    const Unsigned narrow = absToUnsigned(static_cast<IntT>(b));
+                    const auto wide = absToUnsigned(a);
+                    const Unsigned rest = wide <= narrow ? static_cast<Unsigned>(wide) : static_cast<Unsigned>(wide % narrow);
+                    return static_cast<WideT>(gcd(rest, narrow));
+                }
+            }
+            return gcdOf(a, b);
+        }
+
+        /// @brief Multiplies two storage values in the widened type.
+        /// @return true on overflow, which is only possible when `IntT` is already the widest type available.
+        template <typename IntT>
+        constexpr bool mulWide(IntT a, IntT b, typename IntTraits<IntT>::Wide& result) noexcept {
+            using Wide = typename IntTraits<IntT>::Wide;
+            if constexpr (IntTraits<IntT>::isWidened) {
+                result = static_cast<Wide>(a) * static_cast<Wide>(b); // cannot overflow
+                return false;
+            } else {
+                return mulOverflow(static_cast<Wide>(a), static_cast<Wide>(b), result);
+            }
+        }
+
+        /// @brief -1, 0 or 1 for the sign of `value`.
+        template <typename T>
+        constexpr int signOf(T value) noexcept {
+            return (value > 0) - (value < 0);
+        }
+
+        /// @brief Compares `an/ad` with `bn/bd` for non-zero magnitudes through their continued fractions.
+        /// Each step compares the integer parts and continues with the reciprocals of the remainders,
+        /// so only divisions at the storage width are needed.
+        /// @return negative, zero or positive.
+        template <typename U>
+        constexpr int compareExpansions(U an, U ad, U bn, U bd) noexcept {
+            while (true) {
+                const U quotientA = an / ad;
+                const U quotientB = bn / bd;
+                if (quotientA != quotientB) return quotientA < quotientB ? -1 : 1;
+                const U remainderA = an % ad;
+                const U remainderB = bn % bd;
+                if (remainderA == 0 || remainderB == 0) {
+                    return remainderA == remainderB ? 0 : (remainderA == 0 ? -1 : 1);
+                }
+                // ra/ad < rb/bd exactly when bd/rb < ad/ra
+                const U previousAd = ad;
+                an = bd;
+                ad = remainderB;
+                bn = previousAd;
+                bd = remainderA;
+            }
+        }
+
+        /// @brief Mixes the bits of an unsigned value into 64 bits (the splitmix64 finalizer).
+        /// 128-bit values fold their high half in first.
+        template <typename U>
+        constexpr std::uint64_t mixHash(U value) noexcept {
+            std::uint64_t x = static_cast<std::uint64_t>(value);
+            if constexpr (sizeof(U) > sizeof(std::uint64_t)) x ^= mixHash(static_cast<std::uint64_t>(value >> 64));
+            x += 0x9e3779b97f4a7c15ull;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+            return x ^ (x >> 31);
+        }
+
+        /// @brief Hash of a fraction already in lowest terms, given as the magnitudes `n` and `d` and its sign.
+        template <typename U>
+        constexpr std::size_t hashReduced(U n, U d, bool isNegative) noexcept {
+            const std::uint64_t numeratorHash = mixHash(isNegative ? static_cast<U>(~n) : n);
+            return static_cast<std::size_t>(mixHash(numeratorHash ^ (mixHash(d) * 3)));
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT>::BasicFrac() noexcept : numerator(0), denominator(1) {}
+
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT>::BasicFrac(T n) : numerator(static_cast<IntT>(n)), denominator(1) {
+        if (!detail::fitsIn<IntT>(n)) {
+            detail::raise(FracError::Overflow);
+        }
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT>::BasicFrac(IntT n, IntT d, bool isSimplifying) : numerator(n), denominator(d) {
+        if (denominator == 0){
+            detail::raise(FracError::ZeroDivisor);
+        }
+        // Optional
+        if (isSimplifying) simplify();
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT>::BasicFrac(const char* fracStr, bool isSimplifying) : numerator(0), denominator(1) {
+        FRACLIB_COUNT(conversions, 1);
+        detail::throwOnError(tryParse(fracStr, *this, isSimplifying));
+    }
+
+    template <typename IntT>
+    template <typename OtherIntT, typename>
+    constexpr BasicFrac<IntT>::BasicFrac(const BasicFrac<OtherIntT>& other) : numerator(0), denominator(1) {
+        detail::throwOnError(tryConvert(other, *this));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Basic Arithmetic Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator+(const BasicFrac& other) const {
+        BasicFrac result;
+        detail::throwOnError(tryAdd(*this, other, result));
+        return result;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator+(T value) const {
+        return *(this) + BasicFrac(value);
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator-(const BasicFrac& other) const {
+        BasicFrac result;
+        detail::throwOnError(trySub(*this, other, result));
+        return result;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator-(T value) const {
+        return *(this) - BasicFrac(value);
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator*(const BasicFrac& other) const {
+        BasicFrac result;
+        detail::throwOnError(tryMul(*this, other, result));
+        return result;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator*(T value) const {
+        return *(this) * BasicFrac(value);
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator/(const BasicFrac& other) const {
+        BasicFrac result;
+        detail::throwOnError(tryDiv(*this, other, result));
+        return result;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator/(T value) const {
+        return *(this) / BasicFrac(value);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Compound Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator+=(const BasicFrac& other) {
+        (*this) = *(this) + other;
+        return *this;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator+=(T value) {
+        (*this) = *(this) + BasicFrac(value);
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator-=(const BasicFrac& other) {
+        (*this) = *(this) - other;
+        return *this;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator-=(T value) {
+        (*this) = *(this) - BasicFrac(value);
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator*=(const BasicFrac& other) {
+        (*this) = *(this) * other;
+        return *this;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator*=(T value) {
+        (*this) = *(this) * BasicFrac(value);
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator/=(const BasicFrac& other) {
+        (*this) = *(this) / other;
+        return *this;
+    }
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator/=(T value) {
+        (*this) = *(this) / BasicFrac(value);
+        return *this;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Increment Decrement Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator++(){
+        (*this) = *(this) + BasicFrac(1);
+        return *this;
+    }
+    template <typename IntT>
+    constexpr BasicFrac<IntT>& BasicFrac<IntT>::operator--(){
+        (*this) = *(this) - BasicFrac(1);
+        return *this;
+    }
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator++(int){
+        BasicFrac temp = *this;
+        (*this) = *(this) + BasicFrac(1);
+        return temp;
+    }
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator--(int){
+        BasicFrac temp = *this;
+        (*this) = *(this) - BasicFrac(1);
+        return temp;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Unary Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::operator-() const {
+        BasicFrac result;
+        detail::throwOnError(tryNegate(*this, result));
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Comparision Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator==(const BasicFrac& other) const noexcept {
+        if constexpr (detail::IntTraits<IntT>::isWidened) {
+            // This cross-multiplication avoids the need to reduce the fractions to their simplest forms,
+            // and equality does not depend on the signs of the denominators.
+            using Wide = typename detail::IntTraits<IntT>::Wide;
+            return static_cast<Wide>(this->numerator) * other.denominator == static_cast<Wide>(other.numerator) * this->denominator;
+        } else {
+            return compare(*this, other) == 0;
+        }
+    }
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator!=(const BasicFrac& other) const noexcept {
+        return !(*this == other);  // implement != by negating ==
+    }
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator>=(const BasicFrac& other) const noexcept {
+        return compare(*this, other) >= 0;
+    }
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator<=(const BasicFrac& other) const noexcept {
+        return compare(*this, other) <= 0;
+    }
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator>(const BasicFrac& other) const noexcept {
+        return compare(*this, other) > 0;
+    }
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::operator<(const BasicFrac& other) const noexcept {
+        return compare(*this, other) < 0;
+    }
+#ifdef FRACLIB_HAS_THREE_WAY_COMPARISON
+    template <typename IntT>
+    constexpr std::weak_ordering BasicFrac<IntT>::operator<=>(const BasicFrac& other) const noexcept {
+        const int order = compare(*this, other);
+        return order < 0 ? std::weak_ordering::less : (order > 0 ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+    }
+#endif
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr int BasicFrac<IntT>::compare(const BasicFrac& a, const BasicFrac& b) noexcept {
+        if constexpr (detail::IntTraits<IntT>::isWidened) {
+            // The cross products cannot overflow in `Wide`. Two multiplies are cheaper than
+            // branching on fast paths, and denominators of opposite signs reverse the order.
+            using Wide = typename detail::IntTraits<IntT>::Wide;
+            const bool isReversed = (a.denominator ^ b.denominator) < 0;
+            const Wide crossA = static_cast<Wide>(a.numerator) * b.denominator;
+            const Wide crossB = static_cast<Wide>(b.numerator) * a.denominator;
+            const Wide left = isReversed ? crossB : crossA;
+            const Wide right = isReversed ? crossA : crossB;
+            return (left > right) - (left < right);
+        } else {
+            const int signA = detail::signOf(a.numerator) * detail::signOf(a.denominator);
+            const int signB = detail::signOf(b.numerator) * detail::signOf(b.denominator);
+            if (signA != signB) return signA < signB ? -1 : 1;
+            if (signA == 0) return 0;
+            // Common denominators need no expansion at all
+            if (a.denominator == b.denominator) {
+                const int order = (a.numerator > b.numerator) - (a.numerator < b.numerator);
+                return a.denominator > 0 ? order : -order;
+            }
+            const int order = detail::compareExpansions(detail::absToUnsigned(a.numerator), detail::absToUnsigned(a.denominator),
+                detail::absToUnsigned(b.numerator), detail::absToUnsigned(b.denominator));
+            return signA > 0 ? order : -order;
+        }
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::parse(std::string_view str, bool isSimplifying){
+        BasicFrac result;
+        detail::throwOnError(tryParse(str, result, isSimplifying));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::toReciprocal(const BasicFrac& frac){
+        BasicFrac result;
+        detail::throwOnError(tryReciprocal(frac, result));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::fma(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c){
+        BasicFrac result;
+        detail::throwOnError(tryFma(a, b, c, result));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::dot2(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, const BasicFrac& d){
+        BasicFrac result;
+        detail::throwOnError(tryDot2(a, b, c, d, result));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr void BasicFrac<IntT>::SimplifyFrac(BasicFrac& frac){
+        frac.simplify();
+    }
+
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicFrac<IntT>::Simplify(BasicFrac frac){
+        frac.simplify();
+        return frac;
+    }
+
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::isCanonical() const noexcept {
+        if (this->denominator <= 0) return false;
+        if (this->denominator == 1) return true;
+        if (this->numerator == 0) return false; // 0/d is canonical only as 0/1
+        // Two even parts share a factor of two
+        if (((this->numerator | this->denominator) & 1) == 0) return false;
+        return detail::gcd(detail::absToUnsigned(this->numerator), detail::absToUnsigned(this->denominator)) == 1;
+    }
+
+    template <typename IntT>
+    constexpr std::size_t BasicFrac<IntT>::hash() const noexcept {
+        // Reduced in the unsigned type so no value (ie. the minimum over -1) can overflow
+        auto n = detail::absToUnsigned(this->numerator);
+        auto d = detail::absToUnsigned(this->denominator);
+        const bool isNegative = n != 0 && ((this->numerator < 0) != (this->denominator < 0));
+        if (n == 0) {
+            d = 1;
+        } else if (d != 1) {
+            const auto gcd = detail::gcd(n, d);
+            n /= gcd;
+            d /= gcd;
+        }
+        return detail::hashReduced(n, d, isNegative);
+    }
+
+    template <typename IntT>
+    constexpr void BasicFrac<IntT>::simplify(){
+        detail::throwOnError(trySimplify(*this));
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::addReduced(const BasicFrac& lhs, const BasicFrac& rhs, bool isSubtracting, BasicFrac& out) noexcept {
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        const auto combine = [isSubtracting](Wide a, Wide b, Wide& result) {
+            return isSubtracting ? detail::subOverflow(a, b, result) : detail::addOverflow(a, b, result);
+        };
+        Wide left = 0, right = 0, sum = 0, denominator = 0;
+
+        // Equal denominators only combine the numerators. This also covers two minimum denominators,
+        // whose GCD is not representable in `IntT`.
+        if (lhs.denominator == rhs.denominator) {
+            if (combine(static_cast<Wide>(lhs.numerator), static_cast<Wide>(rhs.numerator), sum)) {
+                return FracError::Overflow;
+            }
+            return fromWide(sum, static_cast<Wide>(lhs.denominator), out);
+        }
+
+        // Integers and unrelated denominators share no factor, so plain cross multiplication is already reduced
+        const IntT gcd = (lhs.denominator == 1 || rhs.denominator == 1) ? 1 : detail::gcdOf(lhs.denominator, rhs.denominator);
+        if (gcd == 1) {
+            if (detail::mulWide(lhs.numerator, rhs.denominator, left) || detail::mulWide(rhs.numerator, lhs.denominator, right) ||
+                combine(left, right, sum) || detail::mulWide(lhs.denominator, rhs.denominator, denominator)) {
+                return FracError::Overflow;
+            }
+            return fromWide(sum, denominator, out);
+        }
+
+        // Henrici: a/b + c/d = (a*(d/g) + c*(b/g)) / (b/g * d), then cancel what the sum still shares with g
+        const IntT lhsDenominator = lhs.denominator / gcd;
+        const IntT rhsDenominator = rhs.denominator / gcd;
+        if (detail::mulWide(lhs.numerator, rhsDenominator, left) || detail::mulWide(rhs.numerator, lhsDenominator, right) ||
+            combine(left, right, sum)) {
+            return FracError::Overflow;
+        }
+        const Wide common = detail::gcdOf(sum, static_cast<Wide>(gcd));
+        if (detail::mulWide(lhsDenominator, static_cast<IntT>(rhs.denominator / common), denominator)) {
+            return FracError::Overflow;
+        }
+        return fromWide(sum / common, denominator, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::mulReduced(IntT n1, IntT d1, IntT n2, IntT d2, BasicFrac& out) noexcept {
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        Wide n = 0, d = 0;
+        if (productWide(n1, d1, n2, d2, n, d)) {
+            return FracError::Overflow;
+        }
+        return fromWide(n, d, out);
+    }
+
+    template <typename IntT>
+    constexpr bool BasicFrac<IntT>::productWide(IntT n1, IntT d1, IntT n2, IntT d2,
+        typename detail::IntTraits<IntT>::Wide& n, typename detail::IntTraits<IntT>::Wide& d) noexcept {
+        // Cross-reduce first so the products stay as small as possible
+        const IntT gcd1 = (d2 == 1) ? 1 : detail::gcdOf(n1, d2);
+        const IntT gcd2 = (d1 == 1) ? 1 : detail::gcdOf(n2, d1);
+        return detail::mulWide(static_cast<IntT>(n1 / gcd1), static_cast<IntT>(n2 / gcd2), n) ||
+            detail::mulWide(static_cast<IntT>(d1 / gcd2), static_cast<IntT>(d2 / gcd1), d);
+    }
+
+    template <typename IntT>
+    template <typename WideT>
+    constexpr FracError BasicFrac<IntT>::sumWide(WideT n1, WideT d1, WideT n2, WideT d2, BasicFrac& out) noexcept {
+        // Same steps as addReduced, one width up
+        const WideT gcd = (d1 == 1 || d2 == 1) ? 1 : detail::gcdOfWide<IntT>(d1, d2);
+        const WideT lhsDenominator = d1 / gcd;
+        const WideT rhsDenominator = d2 / gcd;
+        WideT left = 0, right = 0, sum = 0, denominator = 0;
+        if (detail::mulOverflow(n1, rhsDenominator, left) || detail::mulOverflow(n2, lhsDenominator, right) ||
+            detail::addOverflow(left, right, sum)) {
+            return FracError::Overflow;
+        }
+        const WideT common = (gcd == 1) ? 1 : detail::gcdOfWide<IntT>(sum, gcd);
+        if (detail::mulOverflow(lhsDenominator, static_cast<WideT>(d2 / common), denominator)) {
+            return FracError::Overflow;
+        }
+        return fromWide(static_cast<WideT>(sum / common), denominator, out);
+    }
+
+    template <typename IntT>
+    template <typename WideT>
+    constexpr FracError BasicFrac<IntT>::fromWide(WideT n, WideT d, BasicFrac& out, bool isReducing) noexcept {
+        if (d == 0) {
+            return FracError::ZeroDivisor;
+        }
+        if (n == 0) {
+            out.numerator = 0;
+            out.denominator = 1;
+            return FracError::None;
+        }
+
+        // Reduced before the sign is normalized, so only values that stay out of range fail. A result
+        // that does not fit is always reduced, and an integer has nothing to cancel.
+        if ((isReducing && d != 1 && d != -1) || !detail::fitsIn<IntT>(n) || !detail::fitsIn<IntT>(d)) {
+            const WideT gcd = detail::gcdOfWide<IntT>(n, d);
+            n /= gcd;
+            d /= gcd;
+        }
+
+        // Ensure the denominator is always positive
+        if (d < 0) {
+            if (detail::subOverflow(static_cast<WideT>(0), n, n) || detail::subOverflow(static_cast<WideT>(0), d, d)) {
+                return FracError::Overflow;
+            }
+        }
+        if (detail::countOverflow(!detail::fitsIn<IntT>(n) || !detail::fitsIn<IntT>(d))) {
+            return FracError::Overflow;
+        }
+        out.numerator = static_cast<IntT>(n);
+        out.denominator = static_cast<IntT>(d);
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    constexpr float BasicFrac<IntT>::toFloat(const BasicFrac& frac){
+        return static_cast<float>(frac.numerator) / static_cast<float>(frac.denominator);
+    }
+
+    template <typename IntT>
+    constexpr double BasicFrac<IntT>::toDouble(const BasicFrac& frac){
+        return static_cast<double>(frac.numerator) / static_cast<double>(frac.denominator);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Non-Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryMake(IntT n, IntT d, BasicFrac& out, bool isSimplifying) noexcept {
+        if (d == 0) {
+            return FracError::ZeroDivisor;
+        }
+        BasicFrac result;
+        result.numerator = n;
+        result.denominator = d;
+        if (isSimplifying) {
+            const FracError error = trySimplify(result);
+            if (error != FracError::None) return error;
+        }
+        out = result;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr FracError BasicFrac<IntT>::tryMake(T n, BasicFrac& out) noexcept {
+        if (!detail::fitsIn<IntT>(n)) {
+            return FracError::Overflow;
+        }
+        out.numerator = static_cast<IntT>(n);
+        out.denominator = 1;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    template <typename OtherIntT>
+    constexpr FracError BasicFrac<IntT>::tryConvert(const BasicFrac<OtherIntT>& other, BasicFrac& out) noexcept {
+        // Normalized in the wider of the two types, so a narrow minimum over -1 can still be negated
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        using Common = std::conditional_t<(sizeof(OtherIntT) > sizeof(Wide)), OtherIntT, Wide>;
+        return fromWide(static_cast<Common>(other.numerator), static_cast<Common>(other.denominator), out, false);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryAdd(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        return addReduced(a, b, false, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::trySub(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        return addReduced(a, b, true, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryMul(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        return mulReduced(a.numerator, a.denominator, b.numerator, b.denominator, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryDiv(const BasicFrac& a, const BasicFrac& b, BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        if (b.numerator == 0) {
+            return FracError::ZeroDivisor;
+        }
+        // reciprocal of b then multiply
+        return mulReduced(a.numerator, a.denominator, b.denominator, b.numerator, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryFma(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        Wide n = 0, d = 0;
+        if (productWide(a.numerator, a.denominator, b.numerator, b.denominator, n, d)) {
+            return FracError::Overflow;
+        }
+        return sumWide(n, d, static_cast<Wide>(c.numerator), static_cast<Wide>(c.denominator), out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryDot2(const BasicFrac& a, const BasicFrac& b, const BasicFrac& c, const BasicFrac& d,
+        BasicFrac& out) noexcept {
+        FRACLIB_COUNT(operations, 1);
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        Wide n1 = 0, d1 = 0, n2 = 0, d2 = 0;
+        if (productWide(a.numerator, a.denominator, b.numerator, b.denominator, n1, d1) ||
+            productWide(c.numerator, c.denominator, d.numerator, d.denominator, n2, d2)) {
+            return FracError::Overflow;
+        }
+        return sumWide(n1, d1, n2, d2, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryNegate(const BasicFrac& a, BasicFrac& out) noexcept {
+        // Handles negating numerator (+/-), then normalizes like every other result
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        Wide negated = 0;
+        if (detail::subOverflow(static_cast<Wide>(0), static_cast<Wide>(a.numerator), negated)) {
+            return FracError::Overflow;
+        }
+        return fromWide(negated, static_cast<Wide>(a.denominator), out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryReciprocal(const BasicFrac& a, BasicFrac& out) noexcept {
+        if (a.numerator == 0) {
+            return FracError::ZeroDivisor;
+        }
+        return fromWide(a.denominator, a.numerator, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::trySimplify(BasicFrac& frac) noexcept {
+        FRACLIB_COUNT(simplifications, 1);
+        if(frac.denominator == 0) return FracError::None; // quick fix for 0
+        if(frac.numerator == 0) {
+            frac.denominator = 1;
+            return FracError::None;
+        }
+
+        // Binary GCD of the magnitudes, computed unsigned so the minimum value is handled
+        const auto gcd = detail::gcd(detail::absToUnsigned(frac.numerator), detail::absToUnsigned(frac.denominator));
+        if (gcd > static_cast<decltype(gcd)>(detail::IntTraits<IntT>::max)) { // only when both are the minimum value
+            frac.numerator = 1;
+            frac.denominator = 1;
+            return FracError::None;
+        }
+
+        // Ensure the denominator is always positive. Only an unreduced minimum value cannot be negated,
+        // so the fraction is left untouched in that case.
+        IntT numerator = frac.numerator / static_cast<IntT>(gcd);
+        IntT denominator = frac.denominator / static_cast<IntT>(gcd);
+        if (denominator < 0) {
+            if (numerator == detail::IntTraits<IntT>::min || denominator == detail::IntTraits<IntT>::min) {
+                return FracError::Overflow;
+            }
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        frac.numerator = numerator;
+        frac.denominator = denominator;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryParse(std::string_view str, BasicFrac& out, bool isSimplifying) noexcept {
+        const char* last = str.data() + str.size();
+        BasicFrac result;
+        const FracParseResult parsed = fromChars(str.data(), last, result, isSimplifying);
+        if (parsed.error != FracError::None) {
+            return parsed.error;
+        }
+
+        // Only trailing whitespace may follow the fraction
+        for (const char* p = parsed.ptr; p != last; ++p) {
+            if (*p != ' ' && *p != '\t' && *p != '\n' && *p != '\r' && *p != '\f' && *p != '\v') {
+                return FracError::InvalidString;
+            }
+        }
+        out = result;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::tryParseExact(std::string_view str, BasicFrac& out) noexcept {
+        // Trimmed and dispatched like readFromStream
+        constexpr std::string_view whitespace = " \t\n\r\f\v";
+        const std::size_t first = str.find_first_not_of(whitespace);
+        if (first == std::string_view::npos) {
+            return FracError::InvalidString;
+        }
+        str = str.substr(first, str.find_last_not_of(whitespace) - first + 1);
+        if ((str[0] < '0' || str[0] > '9') && str[0] != '-') {
+            return FracError::InvalidString;
+        }
+
+        const FracError error = tryParse(str, out);
+        return error == FracError::InvalidString ? parseExactDecimal(str, out) : error;
+    }
+
+    template <typename IntT>
+    constexpr FracParseResult BasicFrac<IntT>::fromChars(const char* first, const char* last, BasicFrac& out, bool isSimplifying) noexcept {
+        const FracParseResult result = parseChars(first, last, out, isSimplifying);
+        FRACLIB_COUNT(parses, 1);
+        FRACLIB_COUNT(parsedBytes, static_cast<std::uint64_t>(result.ptr - first));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr FracParseResult BasicFrac<IntT>::parseChars(const char* first, const char* last, BasicFrac& out, bool isSimplifying) noexcept {
+        const auto isDigit = [](char ch) { return ch >= '0' && ch <= '9'; };
+        const auto isBlank = [](char ch) { return ch == ' ' || ch == '\t'; };
+
+        // Consumes every digit at p. Returns false on overflow, in which case p still ends past the digits
+        const auto parseNumber = [&](const char*& p, IntT& value) {
+            bool isOverflow = false;
+            value = 0;
+            for (; p != last && isDigit(*p); ++p) {
+                // builds full number digit by digit. -'0' gets actual numerical value instead of string representation
+                isOverflow = isOverflow || detail::mulOverflow(value, static_cast<IntT>(10), value) ||
+                    detail::addOverflow(value, static_cast<IntT>(*p - '0'), value);
+            }
+            return !isOverflow;
+        };
+
+        const char* p = first;
+        while (p != last && isBlank(*p)) ++p;
+
+        const bool isNegative = (p != last && *p == '-');
+        if (isNegative) ++p;
+        if (p == last || !isDigit(*p)) { // must be numeric or format is incorrect
+            return {p, FracError::InvalidString};
+        }
+
+        IntT whole = 0, num = 0, denom = 1;
+        bool isMixed = false;
+        if (!parseNumber(p, num)) return {p, FracError::Overflow};
+
+        // A blank followed by digits and '/' is a mixed fraction. Otherwise the whole number ends here.
+        if (p != last && isBlank(*p)) {
+            const char* next = p;
+            while (next != last && isBlank(*next)) ++next;
+            IntT part = 0;
+            const char* partEnd = next;
+            if (next != last && isDigit(*next)) {
+                const bool isPartValid = parseNumber(partEnd, part);
+                if (partEnd != last && *partEnd == '/') {
+                    if (!isPartValid) return {partEnd, FracError::Overflow};
+                    isMixed = true;
+                    whole = num;
+                    num = part;
+                    p = partEnd;
+                }
+            }
+        }
+
+        if (p != last && *p == '/') {
+            ++p;
+            while (p != last && isBlank(*p)) ++p;
+            if (p == last || !isDigit(*p)) {
+                return {p, FracError::InvalidString};
+            }
+            if (!parseNumber(p, denom)) return {p, FracError::Overflow};
+
+            // Check for zero denominator
+            if (denom == 0) return {p, FracError::ZeroDivisor};
+        }
+
+        // Check for mixed fraction and calculate numerator
+        IntT numerator = num;
+        if (isMixed && (detail::mulOverflow(denom, whole, numerator) || detail::addOverflow(numerator, num, numerator))) {
+            return {p, FracError::Overflow};
+        }
+        if (isNegative) numerator = -numerator; // cannot overflow, the magnitude is at most the maximum
+
+        return {p, tryMake(numerator, denom, out, isSimplifying)};
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicFrac<IntT>::parseExactDecimal(std::string_view str, BasicFrac& out) noexcept {
+        // digits * 10^scale. Trailing zeros are held back so they only grow the scale.
+        std::size_t i = 0;
+        const bool isNegative = (i < str.size() && str[i] == '-');
+        if (isNegative) i++;
+
+        IntT numerator = 0;
+        bool isOverflow = false, hasDigits = false, hasPoint = false;
+        long scale = 0, zeros = 0;
+        for (; i < str.size(); i++) {
+            const char ch = str[i];
+            if (ch == '.' && !hasPoint) {
+                hasPoint = true;
+                continue;
+            }
+            if (ch < '0' || ch > '9') break;
+            hasDigits = true;
+            if (hasPoint) scale--;
+            if (ch == '0') {
+                zeros++;
+                continue;
+            }
+            for (; zeros > 0 && !isOverflow; zeros--) {
+                isOverflow = detail::mulOverflow(numerator, static_cast<IntT>(10), numerator);
+            }
+            isOverflow = isOverflow || detail::mulOverflow(numerator, static_cast<IntT>(10), numerator) ||
+                detail::addOverflow(numerator, static_cast<IntT>(ch - '0'), numerator);
+        }
+        if (!hasDigits) return FracError::InvalidString;
+        scale += zeros;
+
+        // Optional exponent, clamped far beyond any representable power of ten
+        if (i < str.size() && (str[i] == 'e' || str[i] == 'E')) {
+            i++;
+            const bool isExponentNegative = (i < str.size() && str[i] == '-');
+            if (i < str.size() && (str[i] == '-' || str[i] == '+')) i++;
+            if (i == str.size() || str[i] < '0' || str[i] > '9') return FracError::InvalidString;
+            long exponent = 0;
+            for (; i < str.size() && str[i] >= '0' && str[i] <= '9'; i++) {
+                if (exponent < 100000) exponent = exponent * 10 + (str[i] - '0');
+            }
+            scale += isExponentNegative ? -exponent : exponent;
+        }
+        if (i != str.size()) return FracError::InvalidString;
+        if (isOverflow) return FracError::Overflow;
+        if (numerator == 0) {
+            out.numerator = 0;
+            out.denominator = 1;
+            return FracError::None;
+        }
+
+        // 10^-scale = 2^-scale * 5^-scale, cancelled against the numerator, leaves the result in lowest terms
+        IntT denominator = 1;
+        if (scale > 0) {
+            for (; scale > 0 && !isOverflow; scale--) isOverflow = detail::mulOverflow(numerator, static_cast<IntT>(10), numerator);
+        } else {
+            long twos = -scale, fives = -scale;
+            for (; twos > 0 && numerator % 2 == 0; twos--) numerator /= 2;
+            for (; fives > 0 && numerator % 5 == 0; fives--) numerator /= 5;
+            for (; twos > 0 && !isOverflow; twos--) isOverflow = detail::mulOverflow(denominator, static_cast<IntT>(2), denominator);
+            for (; fives > 0 && !isOverflow; fives--) isOverflow = detail::mulOverflow(denominator, static_cast<IntT>(5), denominator);
+        }
+        if (isOverflow) return FracError::Overflow;
+        out.numerator = isNegative ? static_cast<IntT>(-numerator) : numerator;
+        out.denominator = denominator;
+        return FracError::None;
+    }
+}
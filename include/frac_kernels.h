@@ -0,0 +1,771 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_kernels.h
+ * Description:
+ *  This header file implements the SIMD batch kernels behind `FracArray` and
+ *  `Frac::SimplifyBatch`, for 32-bit numerators and denominators stored in
+ *  separate buffers. Every kernel has a scalar loop plus AVX2, AVX-512 and
+ *  NEON versions, and a dispatcher that runs the one `detail::simdLevel()`
+ *  selects (see `frac_simd.h`).
+ *
+ *  - Arithmetic: lanes are widened to 64 bits and the unreduced cross
+ *    products are formed, which cannot overflow. A block whose results all
+ *    fit in `int` is stored as is; otherwise it is redone one lane at a time
+ *    through the reducing `Frac::try*` functions.
+ *  - Simplification: a lane-parallel binary GCD using only shifts, unsigned
+ *    min/max and subtraction, the trailing zero count being read from the
+ *    exponent of the lowest set bit converted to float. Terms are then
+ *    divided exactly through double precision (both fit in 53 bits) and the
+ *    sign is moved to the numerator. Blocks containing `INT_MIN`, the only
+ *    value that can fail to normalize, run through `Frac::trySimplify`.
+ *  - Comparison: every lane is compared against a threshold through 64-bit
+ *    cross products, as `Frac::compare` does, and the lane results are
+ *    packed into 64-bit mask words without branching.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by `frac.h`.
+ *  Otherwise `src/frac_array.cpp` compiles it into the static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_overflow.h"
+#include "frac_simd.h"
+#include <cstdint>
+#include <cstring>
+
+// GCC 12 reports false -Wmaybe-uninitialized warnings inside its own AVX-512 intrinsics
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Arithmetic Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        enum class BatchOp { Add, Sub, Mul, Div };
+
+        /// @brief Unreduced 64-bit result of one lane, with the sign moved to the numerator.
+        /// Cross products of minimum values can overflow the sum or the negation, which like
+        /// any other result that is too wide leaves the lane to the reducing scalar path.
+        /// @return true if the result fits in `int` without reduction.
+        template <BatchOp op>
+        inline bool wideLane(int n1, int d1, int n2, int d2, std::int64_t& n, std::int64_t& d) noexcept {
+            if constexpr (op == BatchOp::Add) {
+                if (addOverflow(static_cast<std::int64_t>(n1) * d2, static_cast<std::int64_t>(n2) * d1, n)) return false;
+                d = static_cast<std::int64_t>(d1) * d2;
+            } else if constexpr (op == BatchOp::Sub) {
+                if (subOverflow(static_cast<std::int64_t>(n1) * d2, static_cast<std::int64_t>(n2) * d1, n)) return false;
+                d = static_cast<std::int64_t>(d1) * d2;
+            } else if constexpr (op == BatchOp::Mul) {
+                n = static_cast<std::int64_t>(n1) * n2;
+                d = static_cast<std::int64_t>(d1) * d2;
+            } else {
+                n = static_cast<std::int64_t>(n1) * d2;
+                d = static_cast<std::int64_t>(d1) * n2;
+            }
+            if (d < 0) {
+                if (n == IntTraits<std::int64_t>::min) return false;
+                n = -n;
+                d = -d;
+            }
+            return d > 0 && d <= IntTraits<int>::max && n >= IntTraits<int>::min && n <= IntTraits<int>::max;
+        }
+
+        /// @brief Lane computed through the reducing scalar API, used when the unreduced result does not fit.
+        template <BatchOp op>
+        inline FracError reducedLane(const Frac& a, const Frac& b, Frac& out) noexcept {
+            if constexpr (op == BatchOp::Add) return Frac::tryAdd(a, b, out);
+            else if constexpr (op == BatchOp::Sub) return Frac::trySub(a, b, out);
+            else if constexpr (op == BatchOp::Mul) return Frac::tryMul(a, b, out);
+            else return Frac::tryDiv(a, b, out);
+        }
+
+        /// @brief Computes lane `i` exactly, reducing when needed. The right-hand side is
+        /// `n2[i], d2[i]`, or `n2[0], d2[0]` when `isBroadcast` is true.
+        /// A failed lane is set to `0/1` and reported in `status[i]`.
+        /// @return 1 if the lane failed, 0 otherwise.
+        template <BatchOp op, bool isBroadcast>
+        inline std::size_t batchLane(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t i, FracError* status) noexcept {
+            const std::size_t j = isBroadcast ? 0 : i;
+            std::int64_t n = 0, d = 0;
+            if (wideLane<op>(n1[i], d1[i], n2[j], d2[j], n, d)) {
+                outN[i] = static_cast<int>(n);
+                outD[i] = static_cast<int>(d);
+                return 0;
+            }
+            Frac a, b, result;
+            a.numerator = n1[i]; a.denominator = d1[i];
+            b.numerator = n2[j]; b.denominator = d2[j];
+            const FracError error = reducedLane<op>(a, b, result);
+            if (error == FracError::None) {
+                outN[i] = result.numerator;
+                outD[i] = result.denominator;
+                return 0;
+            }
+            outN[i] = 0;
+            outD[i] = 1;
+            if (status != nullptr) status[i] = error;
+            return 1;
+        }
+
+        /// @brief Lanes `[first, count)` one at a time.
+        template <BatchOp op, bool isBroadcast>
+        inline std::size_t runBatchScalar(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t first, std::size_t count, FracError* status) noexcept {
+            std::size_t failures = 0;
+            for (std::size_t i = first; i < count; i++) {
+                failures += batchLane<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, status);
+            }
+            return failures;
+        }
+
+#if defined(FRACLIB_SIMD_AVX512)
+        FRACLIB_TARGET_AVX512 inline __m512i loadWide8(const int* p) {
+            return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        }
+
+        /// @brief 8 lanes of 64 bits per iteration.
+        template <BatchOp op, bool isBroadcast>
+        FRACLIB_TARGET_AVX512 std::size_t runBatchAvx512(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t count, FracError* status) noexcept {
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i intMax = _mm512_set1_epi64(IntTraits<int>::max);
+            const __m512i intMin = _mm512_set1_epi64(IntTraits<int>::min);
+            const __m512i n2Broadcast = _mm512_set1_epi64(n2[0]);
+            const __m512i d2Broadcast = _mm512_set1_epi64(d2[0]);
+            std::size_t failures = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m512i a = loadWide8(n1 + i);
+                const __m512i b = loadWide8(d1 + i);
+                const __m512i c = isBroadcast ? n2Broadcast : loadWide8(n2 + i);
+                const __m512i e = isBroadcast ? d2Broadcast : loadWide8(d2 + i);
+                __m512i n, d;
+                if constexpr (op == BatchOp::Add) {
+                    n = _mm512_add_epi64(_mm512_mul_epi32(a, e), _mm512_mul_epi32(c, b));
+                    d = _mm512_mul_epi32(b, e);
+                } else if constexpr (op == BatchOp::Sub) {
+                    n = _mm512_sub_epi64(_mm512_mul_epi32(a, e), _mm512_mul_epi32(c, b));
+                    d = _mm512_mul_epi32(b, e);
+                } else if constexpr (op == BatchOp::Mul) {
+                    n = _mm512_mul_epi32(a, c);
+                    d = _mm512_mul_epi32(b, e);
+                } else {
+                    n = _mm512_mul_epi32(a, e);
+                    d = _mm512_mul_epi32(b, c);
+                }
+                const __mmask8 negative = _mm512_cmplt_epi64_mask(d, zero);
+                n = _mm512_mask_sub_epi64(n, negative, zero, n);
+                d = _mm512_mask_sub_epi64(d, negative, zero, d);
+
+                const __mmask8 fits = _mm512_cmpgt_epi64_mask(d, zero) & _mm512_cmple_epi64_mask(d, intMax) &
+                    _mm512_cmple_epi64_mask(n, intMax) & _mm512_cmpge_epi64_mask(n, intMin);
+                if (fits == 0xFF) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outN + i), _mm512_cvtepi64_epi32(n));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outD + i), _mm512_cvtepi64_epi32(d));
+                } else {
+                    failures += runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, i + 8, status);
+                }
+            }
+            return failures + runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, count, status);
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_AVX2)
+        FRACLIB_TARGET_AVX2 inline __m256i loadWide4(const int* p) {
+            return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        }
+
+        /// @brief Stores the low halves of four 64-bit lanes.
+        FRACLIB_TARGET_AVX2 inline void storeNarrow4(int* p, __m256i value) {
+            const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(value, lowHalves)));
+        }
+
+        /// @brief 4 lanes of 64 bits per iteration.
+        template <BatchOp op, bool isBroadcast>
+        FRACLIB_TARGET_AVX2 std::size_t runBatchAvx2(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t count, FracError* status) noexcept {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i one = _mm256_set1_epi64x(1);
+            const __m256i intMax = _mm256_set1_epi64x(IntTraits<int>::max);
+            const __m256i intMin = _mm256_set1_epi64x(IntTraits<int>::min);
+            const __m256i n2Broadcast = _mm256_set1_epi64x(n2[0]);
+            const __m256i d2Broadcast = _mm256_set1_epi64x(d2[0]);
+            std::size_t failures = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m256i a = loadWide4(n1 + i);
+                const __m256i b = loadWide4(d1 + i);
+                const __m256i c = isBroadcast ? n2Broadcast : loadWide4(n2 + i);
+                const __m256i e = isBroadcast ? d2Broadcast : loadWide4(d2 + i);
+                __m256i n, d;
+                if constexpr (op == BatchOp::Add) {
+                    n = _mm256_add_epi64(_mm256_mul_epi32(a, e), _mm256_mul_epi32(c, b));
+                    d = _mm256_mul_epi32(b, e);
+                } else if constexpr (op == BatchOp::Sub) {
+                    n = _mm256_sub_epi64(_mm256_mul_epi32(a, e), _mm256_mul_epi32(c, b));
+                    d = _mm256_mul_epi32(b, e);
+                } else if constexpr (op == BatchOp::Mul) {
+                    n = _mm256_mul_epi32(a, c);
+                    d = _mm256_mul_epi32(b, e);
+                } else {
+                    n = _mm256_mul_epi32(a, e);
+                    d = _mm256_mul_epi32(b, c);
+                }
+                // Conditional negation: (x ^ mask) - mask
+                const __m256i negative = _mm256_cmpgt_epi64(zero, d);
+                n = _mm256_sub_epi64(_mm256_xor_si256(n, negative), negative);
+                d = _mm256_sub_epi64(_mm256_xor_si256(d, negative), negative);
+
+                const __m256i outOfRange = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpgt_epi64(one, d), _mm256_cmpgt_epi64(d, intMax)),
+                    _mm256_or_si256(_mm256_cmpgt_epi64(n, intMax), _mm256_cmpgt_epi64(intMin, n)));
+                if (_mm256_testz_si256(outOfRange, outOfRange)) {
+                    storeNarrow4(outN + i, n);
+                    storeNarrow4(outD + i, d);
+                } else {
+                    failures += runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, i + 4, status);
+                }
+            }
+            return failures + runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, count, status);
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_NEON)
+        /// @brief 4 lanes per iteration, as two pairs of 64-bit lanes.
+        template <BatchOp op, bool isBroadcast>
+        std::size_t runBatchNeon(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t count, FracError* status) noexcept {
+            const int32x4_t n2Broadcast = vdupq_n_s32(n2[0]);
+            const int32x4_t d2Broadcast = vdupq_n_s32(d2[0]);
+            std::size_t failures = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const int32x4_t a = vld1q_s32(n1 + i);
+                const int32x4_t b = vld1q_s32(d1 + i);
+                const int32x4_t c = isBroadcast ? n2Broadcast : vld1q_s32(n2 + i);
+                const int32x4_t e = isBroadcast ? d2Broadcast : vld1q_s32(d2 + i);
+                int64x2_t nLow, nHigh, dLow, dHigh;
+                if constexpr (op == BatchOp::Add) {
+                    nLow = vmlal_s32(vmull_s32(vget_low_s32(a), vget_low_s32(e)), vget_low_s32(c), vget_low_s32(b));
+                    nHigh = vmlal_high_s32(vmull_high_s32(a, e), c, b);
+                    dLow = vmull_s32(vget_low_s32(b), vget_low_s32(e));
+                    dHigh = vmull_high_s32(b, e);
+                } else if constexpr (op == BatchOp::Sub) {
+                    nLow = vmlsl_s32(vmull_s32(vget_low_s32(a), vget_low_s32(e)), vget_low_s32(c), vget_low_s32(b));
+                    nHigh = vmlsl_high_s32(vmull_high_s32(a, e), c, b);
+                    dLow = vmull_s32(vget_low_s32(b), vget_low_s32(e));
+                    dHigh = vmull_high_s32(b, e);
+                } else if constexpr (op == BatchOp::Mul) {
+                    nLow = vmull_s32(vget_low_s32(a), vget_low_s32(c));
+                    nHigh = vmull_high_s32(a, c);
+                    dLow = vmull_s32(vget_low_s32(b), vget_low_s32(e));
+                    dHigh = vmull_high_s32(b, e);
+                } else {
+                    nLow = vmull_s32(vget_low_s32(a), vget_low_s32(e));
+                    nHigh = vmull_high_s32(a, e);
+                    dLow = vmull_s32(vget_low_s32(b), vget_low_s32(c));
+                    dHigh = vmull_high_s32(b, c);
+                }
+                const uint64x2_t negativeLow = vcltzq_s64(dLow);
+                const uint64x2_t negativeHigh = vcltzq_s64(dHigh);
+                nLow = vbslq_s64(negativeLow, vnegq_s64(nLow), nLow);
+                nHigh = vbslq_s64(negativeHigh, vnegq_s64(nHigh), nHigh);
+                dLow = vbslq_s64(negativeLow, vnegq_s64(dLow), dLow);
+                dHigh = vbslq_s64(negativeHigh, vnegq_s64(dHigh), dHigh);
+
+                // Saturating narrow, a lane fits when it survives the round trip unchanged
+                const int32x4_t n = vcombine_s32(vqmovn_s64(nLow), vqmovn_s64(nHigh));
+                const int32x4_t d = vcombine_s32(vqmovn_s64(dLow), vqmovn_s64(dHigh));
+                const uint64x2_t fitsLow = vandq_u64(vandq_u64(vceqq_s64(vmovl_s32(vget_low_s32(n)), nLow),
+                    vceqq_s64(vmovl_s32(vget_low_s32(d)), dLow)), vcgtzq_s64(dLow));
+                const uint64x2_t fitsHigh = vandq_u64(vandq_u64(vceqq_s64(vmovl_high_s32(n), nHigh),
+                    vceqq_s64(vmovl_high_s32(d), dHigh)), vcgtzq_s64(dHigh));
+                if (vminvq_u32(vreinterpretq_u32_u64(vandq_u64(fitsLow, fitsHigh))) == 0xFFFFFFFFu) {
+                    vst1q_s32(outN + i, n);
+                    vst1q_s32(outD + i, d);
+                } else {
+                    failures += runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, i + 4, status);
+                }
+            }
+            return failures + runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, i, count, status);
+        }
+#endif
+
+        /// @brief Runs one arithmetic kernel over `count` lanes with the selected instruction set.
+        /// Each lane reads its inputs before writing its output, so the output may alias an input.
+        /// @return number of failed lanes.
+        template <BatchOp op, bool isBroadcast>
+        std::size_t runBatch(const int* n1, const int* d1, const int* n2, const int* d2,
+            int* outN, int* outD, std::size_t count, FracError* status) noexcept {
+            if (status != nullptr) std::memset(status, 0, count * sizeof(FracError)); // FracError::None
+            switch (simdLevel()) {
+#if defined(FRACLIB_SIMD_AVX512)
+                case SimdLevel::Avx512: return runBatchAvx512<op, isBroadcast>(n1, d1, n2, d2, outN, outD, count, status);
+#endif
+#if defined(FRACLIB_SIMD_AVX2)
+                case SimdLevel::Avx2: return runBatchAvx2<op, isBroadcast>(n1, d1, n2, d2, outN, outD, count, status);
+#endif
+#if defined(FRACLIB_SIMD_NEON)
+                case SimdLevel::Neon: return runBatchNeon<op, isBroadcast>(n1, d1, n2, d2, outN, outD, count, status);
+#endif
+                default: return runBatchScalar<op, isBroadcast>(n1, d1, n2, d2, outN, outD, 0, count, status);
+            }
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Simplify Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Simplifies lanes `[first, count)` one at a time with `Frac::trySimplify`.
+        /// A lane that cannot be normalized is left unchanged and reported in `status[i]`.
+        /// @return number of failed lanes.
+        inline std::size_t simplifyScalar(int* numerators, int* denominators, std::size_t first, std::size_t count, FracError* status) noexcept {
+            std::size_t failures = 0;
+            for (std::size_t i = first; i < count; i++) {
+                Frac value;
+                value.numerator = numerators[i];
+                value.denominator = denominators[i];
+                const FracError error = Frac::trySimplify(value);
+                if (error != FracError::None) {
+                    if (status != nullptr) status[i] = error;
+                    failures++;
+                    continue;
+                }
+                numerators[i] = value.numerator;
+                denominators[i] = value.denominator;
+            }
+            return failures;
+        }
+
+#if defined(FRACLIB_SIMD_AVX512)
+        /// @brief Trailing zero count of 16 positive lanes (negative for zero lanes).
+        FRACLIB_TARGET_AVX512 inline __m512i countTrailingZeros16(__m512i x) {
+            const __m512i lowest = _mm512_and_si512(x, _mm512_sub_epi32(_mm512_setzero_si512(), x));
+            const __m512i exponent = _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(lowest)), 23);
+            return _mm512_sub_epi32(exponent, _mm512_set1_epi32(127));
+        }
+
+        /// @brief `x / g` for 16 lanes where `g` divides `x` exactly.
+        FRACLIB_TARGET_AVX512 inline __m512i divideExact16(__m512i x, __m512i g) {
+            const __m256i low = _mm512_cvttpd_epi32(_mm512_div_pd(
+                _mm512_cvtepi32_pd(_mm512_castsi512_si256(x)), _mm512_cvtepi32_pd(_mm512_castsi512_si256(g))));
+            const __m256i high = _mm512_cvttpd_epi32(_mm512_div_pd(
+                _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(x, 1)), _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(g, 1))));
+            return _mm512_inserti64x4(_mm512_castsi256_si512(low), high, 1);
+        }
+
+        /// @brief 16 lanes per iteration.
+        FRACLIB_TARGET_AVX512 inline std::size_t simplifyAvx512(int* numerators, int* denominators, std::size_t count, FracError* status) noexcept {
+            const __m512i zero = _mm512_setzero_si512();
+            const __m512i one = _mm512_set1_epi32(1);
+            const __m512i intMin = _mm512_set1_epi32(IntTraits<int>::min);
+            std::size_t failures = 0, i = 0;
+            for (; i + 16 <= count; i += 16) {
+                __m512i n = _mm512_loadu_si512(numerators + i);
+                __m512i d = _mm512_loadu_si512(denominators + i);
+                if ((_mm512_cmpeq_epi32_mask(n, intMin) | _mm512_cmpeq_epi32_mask(d, intMin)) != 0) {
+                    failures += simplifyScalar(numerators, denominators, i, i + 16, status);
+                    continue;
+                }
+
+                // Lanes with a zero term compute gcd(1, 1) and are fixed up afterwards
+                const __mmask16 isZeroN = _mm512_cmpeq_epi32_mask(n, zero);
+                const __mmask16 isZeroD = _mm512_cmpeq_epi32_mask(d, zero);
+                const __mmask16 inactive = isZeroN | isZeroD;
+                __m512i u = _mm512_mask_mov_epi32(_mm512_abs_epi32(n), inactive, one);
+                __m512i v = _mm512_mask_mov_epi32(_mm512_abs_epi32(d), inactive, one);
+
+                // Binary GCD, lanes where v reached zero are finished
+                const __m512i shift = countTrailingZeros16(_mm512_or_si512(u, v));
+                u = _mm512_srlv_epi32(u, countTrailingZeros16(u));
+                __mmask16 running = 0xFFFF;
+                do {
+                    v = _mm512_srlv_epi32(v, countTrailingZeros16(v));
+                    const __m512i low = _mm512_min_epu32(u, v);
+                    const __m512i high = _mm512_max_epu32(u, v);
+                    u = _mm512_mask_mov_epi32(u, running, low);
+                    v = _mm512_maskz_sub_epi32(running, high, low);
+                    running = _mm512_test_epi32_mask(v, v);
+                } while (running != 0);
+                const __m512i gcd = _mm512_sllv_epi32(u, shift);
+
+                if (_mm512_cmpneq_epi32_mask(gcd, one) != 0) {
+                    n = divideExact16(n, gcd);
+                    d = divideExact16(d, gcd);
+                }
+                const __mmask16 negative = _mm512_cmplt_epi32_mask(d, zero);
+                n = _mm512_mask_sub_epi32(n, negative, zero, n);
+                d = _mm512_mask_sub_epi32(d, negative, zero, d);
+                d = _mm512_mask_mov_epi32(d, isZeroN & ~isZeroD, one);
+                _mm512_storeu_si512(numerators + i, n);
+                _mm512_storeu_si512(denominators + i, d);
+            }
+            return failures + simplifyScalar(numerators, denominators, i, count, status);
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_AVX2)
+        /// @brief Trailing zero count of 8 positive lanes (negative for zero lanes).
+        FRACLIB_TARGET_AVX2 inline __m256i countTrailingZeros8(__m256i x) {
+            const __m256i lowest = _mm256_and_si256(x, _mm256_sub_epi32(_mm256_setzero_si256(), x));
+            const __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23);
+            return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+        }
+
+        /// @brief `x / g` for 8 lanes where `g` divides `x` exactly.
+        FRACLIB_TARGET_AVX2 inline __m256i divideExact8(__m256i x, __m256i g) {
+            const __m128i low = _mm256_cvttpd_epi32(_mm256_div_pd(
+                _mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), _mm256_cvtepi32_pd(_mm256_castsi256_si128(g))));
+            const __m128i high = _mm256_cvttpd_epi32(_mm256_div_pd(
+                _mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), _mm256_cvtepi32_pd(_mm256_extracti128_si256(g, 1))));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        }
+
+        /// @brief 8 lanes per iteration.
+        FRACLIB_TARGET_AVX2 inline std::size_t simplifyAvx2(int* numerators, int* denominators, std::size_t count, FracError* status) noexcept {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i one = _mm256_set1_epi32(1);
+            const __m256i intMin = _mm256_set1_epi32(IntTraits<int>::min);
+            std::size_t failures = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(numerators + i));
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(denominators + i));
+                const __m256i hasMin = _mm256_or_si256(_mm256_cmpeq_epi32(n, intMin), _mm256_cmpeq_epi32(d, intMin));
+                if (!_mm256_testz_si256(hasMin, hasMin)) {
+                    failures += simplifyScalar(numerators, denominators, i, i + 8, status);
+                    continue;
+                }
+
+                // Lanes with a zero term compute gcd(1, 1) and are fixed up afterwards
+                const __m256i isZeroN = _mm256_cmpeq_epi32(n, zero);
+                const __m256i isZeroD = _mm256_cmpeq_epi32(d, zero);
+                const __m256i inactive = _mm256_or_si256(isZeroN, isZeroD);
+                __m256i u = _mm256_blendv_epi8(_mm256_abs_epi32(n), one, inactive);
+                __m256i v = _mm256_blendv_epi8(_mm256_abs_epi32(d), one, inactive);
+
+                // Binary GCD, lanes where v reached zero are finished
+                const __m256i shift = countTrailingZeros8(_mm256_or_si256(u, v));
+                u = _mm256_srlv_epi32(u, countTrailingZeros8(u));
+                do {
+                    v = _mm256_srlv_epi32(v, countTrailingZeros8(v));
+                    const __m256i finished = _mm256_cmpeq_epi32(v, zero);
+                    const __m256i low = _mm256_min_epu32(u, v);
+                    const __m256i high = _mm256_max_epu32(u, v);
+                    u = _mm256_blendv_epi8(low, u, finished);
+                    v = _mm256_andnot_si256(finished, _mm256_sub_epi32(high, low));
+                } while (!_mm256_testz_si256(v, v));
+                const __m256i gcd = _mm256_sllv_epi32(u, shift);
+
+                const __m256i isOne = _mm256_cmpeq_epi32(gcd, one);
+                if (_mm256_movemask_epi8(isOne) != -1) {
+                    n = divideExact8(n, gcd);
+                    d = divideExact8(d, gcd);
+                }
+                const __m256i negative = _mm256_cmpgt_epi32(zero, d);
+                n = _mm256_sub_epi32(_mm256_xor_si256(n, negative), negative);
+                d = _mm256_sub_epi32(_mm256_xor_si256(d, negative), negative);
+                d = _mm256_blendv_epi8(d, one, _mm256_andnot_si256(isZeroD, isZeroN));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(numerators + i), n);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(denominators + i), d);
+            }
+            return failures + simplifyScalar(numerators, denominators, i, count, status);
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_NEON)
+        /// @brief Trailing zero count of 4 lanes (-1 for zero lanes).
+        inline int32x4_t countTrailingZeros4(uint32x4_t x) {
+            const uint32x4_t lowest = vandq_u32(x, vreinterpretq_u32_s32(vnegq_s32(vreinterpretq_s32_u32(x))));
+            return vsubq_s32(vdupq_n_s32(31), vreinterpretq_s32_u32(vclzq_u32(lowest)));
+        }
+
+        /// @brief `x / g` for 4 lanes where `g` divides `x` exactly.
+        inline int32x4_t divideExact4(int32x4_t x, int32x4_t g) {
+            const float64x2_t low = vdivq_f64(vcvtq_f64_s64(vmovl_s32(vget_low_s32(x))), vcvtq_f64_s64(vmovl_s32(vget_low_s32(g))));
+            const float64x2_t high = vdivq_f64(vcvtq_f64_s64(vmovl_high_s32(x)), vcvtq_f64_s64(vmovl_high_s32(g)));
+            return vcombine_s32(vmovn_s64(vcvtq_s64_f64(low)), vmovn_s64(vcvtq_s64_f64(high)));
+        }
+
+        /// @brief 4 lanes per iteration.
+        inline std::size_t simplifyNeon(int* numerators, int* denominators, std::size_t count, FracError* status) noexcept {
+            const int32x4_t intMin = vdupq_n_s32(IntTraits<int>::min);
+            const uint32x4_t one = vdupq_n_u32(1);
+            std::size_t failures = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                int32x4_t n = vld1q_s32(numerators + i);
+                int32x4_t d = vld1q_s32(denominators + i);
+                if (vmaxvq_u32(vorrq_u32(vceqq_s32(n, intMin), vceqq_s32(d, intMin))) != 0) {
+                    failures += simplifyScalar(numerators, denominators, i, i + 4, status);
+                    continue;
+                }
+
+                // Lanes with a zero term compute gcd(1, 1) and are fixed up afterwards
+                const uint32x4_t isZeroN = vceqzq_s32(n);
+                const uint32x4_t isZeroD = vceqzq_s32(d);
+                const uint32x4_t inactive = vorrq_u32(isZeroN, isZeroD);
+                uint32x4_t u = vbslq_u32(inactive, one, vreinterpretq_u32_s32(vabsq_s32(n)));
+                uint32x4_t v = vbslq_u32(inactive, one, vreinterpretq_u32_s32(vabsq_s32(d)));
+
+                // Binary GCD, lanes where v reached zero are finished
+                const int32x4_t shift = countTrailingZeros4(vorrq_u32(u, v));
+                u = vshlq_u32(u, vnegq_s32(countTrailingZeros4(u)));
+                do {
+                    v = vshlq_u32(v, vnegq_s32(countTrailingZeros4(v)));
+                    const uint32x4_t finished = vceqzq_u32(v);
+                    const uint32x4_t low = vminq_u32(u, v);
+                    v = vbicq_u32(vsubq_u32(vmaxq_u32(u, v), low), finished);
+                    u = vbslq_u32(finished, u, low);
+                } while (vmaxvq_u32(v) != 0);
+                const int32x4_t gcd = vreinterpretq_s32_u32(vshlq_u32(u, shift));
+
+                if (vminvq_u32(vceqq_s32(gcd, vreinterpretq_s32_u32(one))) == 0) {
+                    n = divideExact4(n, gcd);
+                    d = divideExact4(d, gcd);
+                }
+                const uint32x4_t negative = vcltzq_s32(d);
+                n = vbslq_s32(negative, vnegq_s32(n), n);
+                d = vbslq_s32(negative, vnegq_s32(d), d);
+                d = vbslq_s32(vbicq_u32(isZeroN, isZeroD), vreinterpretq_s32_u32(one), d);
+                vst1q_s32(numerators + i, n);
+                vst1q_s32(denominators + i, d);
+            }
+            return failures + simplifyScalar(numerators, denominators, i, count, status);
+        }
+#endif
+
+        FRACLIB_INLINE std::size_t simplifyBatch(int* numerators, int* denominators, std::size_t count, FracError* status) noexcept {
+            if (status != nullptr) std::memset(status, 0, count * sizeof(FracError)); // FracError::None
+            switch (simdLevel()) {
+#if defined(FRACLIB_SIMD_AVX512)
+                case SimdLevel::Avx512: return simplifyAvx512(numerators, denominators, count, status);
+#endif
+#if defined(FRACLIB_SIMD_AVX2)
+                case SimdLevel::Avx2: return simplifyAvx2(numerators, denominators, count, status);
+#endif
+#if defined(FRACLIB_SIMD_NEON)
+                case SimdLevel::Neon: return simplifyNeon(numerators, denominators, count, status);
+#endif
+                default: return simplifyScalar(numerators, denominators, 0, count, status);
+            }
+        }
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Compare Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        enum class CompareOp { Less, LessEqual, Greater, GreaterEqual, Equal, NotEqual };
+
+        /// @brief Lanes per mask word.
+        constexpr std::size_t MASK_WORD_BITS = 64;
+
+        inline std::size_t popcount64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+            x = x - ((x >> 1) & 0x5555555555555555ull);
+            x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+            x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return static_cast<std::size_t>((x * 0x0101010101010101ull) >> 56);
+#endif
+        }
+        /// @brief Index of the lowest set bit of `x`, which must not be zero.
+        inline std::size_t lowestBit64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(x));
+#else
+            return popcount64((x & (~x + 1)) - 1);
+#endif
+        }
+
+        /// @brief Bits of the lanes matching `op`, from the bits of the lanes ordered below and above
+        /// the threshold. `all` holds the lanes in the word.
+        template <CompareOp op>
+        constexpr std::uint64_t selectOrder(std::uint64_t less, std::uint64_t greater, std::uint64_t all) noexcept {
+            if constexpr (op == CompareOp::Less) return less;
+            else if constexpr (op == CompareOp::LessEqual) return all & ~greater;
+            else if constexpr (op == CompareOp::Greater) return greater;
+            else if constexpr (op == CompareOp::GreaterEqual) return all & ~less;
+            else if constexpr (op == CompareOp::Equal) return all & ~(less | greater);
+            else return less | greater;
+        }
+
+        // Every kernel orders lanes exactly as `Frac::compare`: the cross products `n * td` and `tn * d` are
+        // formed in 64 bits, where they cannot overflow, and swapped when the denominators have opposite
+        // signs. Lanes ordered both ways by the comparison of the products are swapped with `(lt ^ gt) & r`.
+
+        /// @brief Mask word of `count` (at most 64) lanes, one at a time.
+        template <CompareOp op>
+        inline std::uint64_t compareWordScalar(const int* n, const int* d, const Frac& threshold, std::size_t count) noexcept {
+            std::uint64_t less = 0, greater = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                Frac value;
+                value.numerator = n[i];
+                value.denominator = d[i];
+                const int order = Frac::compare(value, threshold);
+                less |= static_cast<std::uint64_t>(order < 0) << i;
+                greater |= static_cast<std::uint64_t>(order > 0) << i;
+            }
+            const std::uint64_t all = count == MASK_WORD_BITS ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+            return selectOrder<op>(less, greater, all);
+        }
+
+        template <CompareOp op>
+        inline std::size_t runCompareScalar(const int* n, const int* d, const Frac& threshold, std::uint64_t* words, std::size_t wordCount) noexcept {
+            std::size_t matches = 0;
+            for (std::size_t w = 0; w < wordCount; w++) {
+                const std::uint64_t word = compareWordScalar<op>(n + w * MASK_WORD_BITS, d + w * MASK_WORD_BITS, threshold, MASK_WORD_BITS);
+                if (words != nullptr) words[w] = word;
+                matches += popcount64(word);
+            }
+            return matches;
+        }
+
+#if defined(FRACLIB_SIMD_AVX512)
+        /// @brief 8 lanes of 64 bits per step, 8 steps per mask word.
+        template <CompareOp op>
+        FRACLIB_TARGET_AVX512 std::size_t runCompareAvx512(const int* n, const int* d, const Frac& threshold, std::uint64_t* words, std::size_t wordCount) noexcept {
+            const __m512i tn = _mm512_set1_epi64(threshold.numerator);
+            const __m512i td = _mm512_set1_epi64(threshold.denominator);
+            const __m256i tdNarrow = _mm256_set1_epi32(threshold.denominator);
+            std::size_t matches = 0;
+            for (std::size_t w = 0; w < wordCount; w++) {
+                std::uint64_t less = 0, greater = 0;
+                for (std::size_t k = 0; k < MASK_WORD_BITS; k += 8) {
+                    const std::size_t i = w * MASK_WORD_BITS + k;
+                    const __m256i numerators = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(n + i));
+                    const __m256i denominators = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + i));
+                    const __m512i left = _mm512_mul_epi32(_mm512_cvtepi32_epi64(numerators), td);
+                    const __m512i right = _mm512_mul_epi32(tn, _mm512_cvtepi32_epi64(denominators));
+                    const std::uint64_t lt = _mm512_cmplt_epi64_mask(left, right);
+                    const std::uint64_t gt = _mm512_cmpgt_epi64_mask(left, right);
+                    const std::uint64_t reversed = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_xor_si256(denominators, tdNarrow))));
+                    const std::uint64_t swap = (lt ^ gt) & reversed;
+                    less |= (lt ^ swap) << k;
+                    greater |= (gt ^ swap) << k;
+                }
+                const std::uint64_t word = selectOrder<op>(less, greater, ~std::uint64_t(0));
+                if (words != nullptr) words[w] = word;
+                matches += popcount64(word);
+            }
+            return matches;
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_AVX2)
+        /// @brief 4 lanes of 64 bits per step, 16 steps per mask word.
+        template <CompareOp op>
+        FRACLIB_TARGET_AVX2 std::size_t runCompareAvx2(const int* n, const int* d, const Frac& threshold, std::uint64_t* words, std::size_t wordCount) noexcept {
+            const __m256i tn = _mm256_set1_epi64x(threshold.numerator);
+            const __m256i td = _mm256_set1_epi64x(threshold.denominator);
+            const __m128i tdNarrow = _mm_set1_epi32(threshold.denominator);
+            std::size_t matches = 0;
+            for (std::size_t w = 0; w < wordCount; w++) {
+                std::uint64_t less = 0, greater = 0;
+                for (std::size_t k = 0; k < MASK_WORD_BITS; k += 4) {
+                    const std::size_t i = w * MASK_WORD_BITS + k;
+                    const __m128i numerators = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n + i));
+                    const __m128i denominators = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+                    const __m256i left = _mm256_mul_epi32(_mm256_cvtepi32_epi64(numerators), td);
+                    const __m256i right = _mm256_mul_epi32(tn, _mm256_cvtepi32_epi64(denominators));
+                    const std::uint64_t lt = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(right, left))));
+                    const std::uint64_t gt = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(left, right))));
+                    const std::uint64_t reversed = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_xor_si128(denominators, tdNarrow))));
+                    const std::uint64_t swap = (lt ^ gt) & reversed;
+                    less |= (lt ^ swap) << k;
+                    greater |= (gt ^ swap) << k;
+                }
+                const std::uint64_t word = selectOrder<op>(less, greater, ~std::uint64_t(0));
+                if (words != nullptr) words[w] = word;
+                matches += popcount64(word);
+            }
+            return matches;
+        }
+#endif
+
+#if defined(FRACLIB_SIMD_NEON)
+        /// @brief Bit `i` set for every lane `i` of `mask` that is all ones.
+        inline std::uint64_t laneBits4(uint32x4_t mask) noexcept {
+            static const std::uint32_t weights[4] = {1, 2, 4, 8};
+            return vaddvq_u32(vandq_u32(mask, vld1q_u32(weights)));
+        }
+
+        /// @brief 4 lanes per step, as two pairs of 64-bit lanes, 16 steps per mask word.
+        template <CompareOp op>
+        std::size_t runCompareNeon(const int* n, const int* d, const Frac& threshold, std::uint64_t* words, std::size_t wordCount) noexcept {
+            const int32x4_t tn = vdupq_n_s32(threshold.numerator);
+            const int32x4_t td = vdupq_n_s32(threshold.denominator);
+            std::size_t matches = 0;
+            for (std::size_t w = 0; w < wordCount; w++) {
+                std::uint64_t less = 0, greater = 0;
+                for (std::size_t k = 0; k < MASK_WORD_BITS; k += 4) {
+                    const std::size_t i = w * MASK_WORD_BITS + k;
+                    const int32x4_t numerators = vld1q_s32(n + i);
+                    const int32x4_t denominators = vld1q_s32(d + i);
+                    const int64x2_t leftLow = vmull_s32(vget_low_s32(numerators), vget_low_s32(td));
+                    const int64x2_t leftHigh = vmull_high_s32(numerators, td);
+                    const int64x2_t rightLow = vmull_s32(vget_low_s32(tn), vget_low_s32(denominators));
+                    const int64x2_t rightHigh = vmull_high_s32(tn, denominators);
+                    const std::uint64_t lt = laneBits4(vcombine_u32(vmovn_u64(vcltq_s64(leftLow, rightLow)), vmovn_u64(vcltq_s64(leftHigh, rightHigh))));
+                    const std::uint64_t gt = laneBits4(vcombine_u32(vmovn_u64(vcgtq_s64(leftLow, rightLow)), vmovn_u64(vcgtq_s64(leftHigh, rightHigh))));
+                    const std::uint64_t reversed = laneBits4(vreinterpretq_u32_s32(vshrq_n_s32(veorq_s32(denominators, td), 31)));
+                    const std::uint64_t swap = (lt ^ gt) & reversed;
+                    less |= (lt ^ swap) << k;
+                    greater |= (gt ^ swap) << k;
+                }
+                const std::uint64_t word = selectOrder<op>(less, greater, ~std::uint64_t(0));
+                if (words != nullptr) words[w] = word;
+                matches += popcount64(word);
+            }
+            return matches;
+        }
+#endif
+
+        /// @brief Compares `count` lanes against `threshold` with the selected instruction set, writing
+        /// bit `i % 64` of `words[i / 64]` for lane `i` unless `words` is null. Bits past `count` are zero.
+        /// @return number of matching lanes.
+        template <CompareOp op>
+        std::size_t runCompare(const int* n, const int* d, const Frac& threshold, std::uint64_t* words, std::size_t count) noexcept {
+            const std::size_t wordCount = count / MASK_WORD_BITS;
+            std::size_t matches = 0;
+            switch (simdLevel()) {
+#if defined(FRACLIB_SIMD_AVX512)
+                case SimdLevel::Avx512: matches = runCompareAvx512<op>(n, d, threshold, words, wordCount); break;
+#endif
+#if defined(FRACLIB_SIMD_AVX2)
+                case SimdLevel::Avx2: matches = runCompareAvx2<op>(n, d, threshold, words, wordCount); break;
+#endif
+#if defined(FRACLIB_SIMD_NEON)
+                case SimdLevel::Neon: matches = runCompareNeon<op>(n, d, threshold, words, wordCount); break;
+#endif
+                default: matches = runCompareScalar<op>(n, d, threshold, words, wordCount); break;
+            }
+            const std::size_t rest = count % MASK_WORD_BITS;
+            if (rest != 0) {
+                const std::size_t first = wordCount * MASK_WORD_BITS;
+                const std::uint64_t word = compareWordScalar<op>(n + first, d + first, threshold, rest);
+                if (words != nullptr) words[wordCount] = word;
+                matches += popcount64(word);
+            }
+            return matches;
+        }
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,438 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_lazy.h
+ * Description:
+ *  This header file defines the BasicLazyFrac class template, a fraction that
+ *  remembers whether it is known to be in lowest terms and only reduces when
+ *  it has to.
+ *
+ *  `BasicFrac` returns every result in lowest terms, whether or not its
+ *  operands were reduced, which costs up to three GCDs per operation: the
+ *  cross-reduction (or Henrici) GCDs and the final reduction, which integer
+ *  results skip. `BasicLazyFrac` instead keeps results unreduced while both
+ *  parts stay below `REDUCE_THRESHOLD`, skips the GCD entirely where the
+ *  result is provably reduced (ie. a reduced fraction plus an integer), and
+ *  reduces once a part grows past the threshold or when the canonical form
+ *  is needed: hashing, output and conversion back to `BasicFrac`.
+ *  Comparisons are exact on any representation and never reduce.
+ *
+ *  The flag lives beside the fraction, so `BasicFrac` keeps its layout and
+ *  `FracArray` and the batch kernels are unaffected.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+
+namespace FracLib {
+    /// @brief Fraction with `IntT` numerator and denominator that defers simplification.
+    /// The denominator is always positive, but the parts are only guaranteed to be in lowest terms
+    /// when `isReduced()` is true. Values equal those of the matching `BasicFrac` operations.
+    /// @tparam IntT signed integer storage type, as for `BasicFrac`.
+    template <typename IntT>
+    class BasicLazyFrac {
+    public: // TYPES
+        using value_type = IntT;
+        using frac_type = BasicFrac<IntT>;
+
+    public: // CONSTANTS
+        /// @brief Results with a part at or above this are reduced right away. Below it the product
+        /// of any two parts fits in `IntT`, so the next operation cannot overflow before reducing.
+        static constexpr IntT REDUCE_THRESHOLD = static_cast<IntT>(1) << (detail::IntTraits<IntT>::digits / 2);
+
+    public: // CONSTRUCTORS
+        /// @brief Default constructor. Initializes the fraction to `0/1`.
+        constexpr BasicLazyFrac() noexcept;
+        /// @brief Constructs the whole number `n`, which is reduced.
+        /// @throws std::overflow_error if `n` does not fit in `IntT`.
+        /// @example LazyFrac f(5); // 5/1
+        template <typename T, typename = detail::EnableIfInteger<T>>
+        constexpr BasicLazyFrac(T n);
+        /// @brief Constructs `n/d`, reduced only if a part reaches `REDUCE_THRESHOLD`. The sign is moved
+        /// to the numerator.
+        /// @throws std::invalid_argument if the denominator is zero.
+        /// @example LazyFrac f(2, 4); // stays 2/4 until reduced
+        constexpr BasicLazyFrac(IntT n, IntT d);
+        /// @brief Wraps a fraction. It is treated as reduced only if that is known without a GCD.
+        /// @throws std::invalid_argument if the denominator is zero.
+        /// @throws std::overflow_error if a negative denominator cannot be moved to the numerator.
+        constexpr BasicLazyFrac(const BasicFrac<IntT>& frac);
+        constexpr BasicLazyFrac(const BasicLazyFrac& other) noexcept = default;
+        constexpr BasicLazyFrac(BasicLazyFrac&& other) noexcept = default;
+
+    public: // OPERATORS
+        // Integers and `BasicFrac` convert implicitly, so either operand may be one of them.
+        friend constexpr BasicLazyFrac operator+(const BasicLazyFrac& a, const BasicLazyFrac& b) { return apply(tryAdd, a, b); }
+        friend constexpr BasicLazyFrac operator-(const BasicLazyFrac& a, const BasicLazyFrac& b) { return apply(trySub, a, b); }
+        friend constexpr BasicLazyFrac operator*(const BasicLazyFrac& a, const BasicLazyFrac& b) { return apply(tryMul, a, b); }
+        friend constexpr BasicLazyFrac operator/(const BasicLazyFrac& a, const BasicLazyFrac& b) { return apply(tryDiv, a, b); }
+
+        constexpr BasicLazyFrac& operator+=(const BasicLazyFrac& other);
+        constexpr BasicLazyFrac& operator-=(const BasicLazyFrac& other);
+        constexpr BasicLazyFrac& operator*=(const BasicLazyFrac& other);
+        constexpr BasicLazyFrac& operator/=(const BasicLazyFrac& other);
+
+        constexpr BasicLazyFrac operator-() const;
+
+        // Comparision
+        // Exact for any representation (see `BasicFrac::compare`), so comparing never reduces.
+        friend constexpr bool operator==(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return isEqual(a, b); }
+        friend constexpr bool operator!=(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return !isEqual(a, b); }
+        friend constexpr bool operator<(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return compare(a, b) < 0; }
+        friend constexpr bool operator<=(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return compare(a, b) <= 0; }
+        friend constexpr bool operator>(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return compare(a, b) > 0; }
+        friend constexpr bool operator>=(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept { return compare(a, b) >= 0; }
+#ifdef FRACLIB_HAS_THREE_WAY_COMPARISON
+        friend constexpr std::weak_ordering operator<=>(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept {
+            const int order = compare(a, b);
+            return order < 0 ? std::weak_ordering::less : (order > 0 ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+        }
+#endif
+
+        // Assignment
+        constexpr BasicLazyFrac& operator=(const BasicLazyFrac& other) noexcept = default;
+        constexpr BasicLazyFrac& operator=(BasicLazyFrac&& other) noexcept = default;
+
+        // Insertion
+        /// @brief Writes the reduced form, as `BasicFrac` does.
+        friend std::ostream& operator<<(std::ostream& os, const BasicLazyFrac& frac) { return os << frac.value(); }
+
+    public: // METHODS
+        /// @brief Stored numerator, not necessarily reduced.
+        constexpr IntT numerator() const noexcept { return this->frac.numerator; }
+        /// @brief Stored denominator (always positive), not necessarily reduced.
+        constexpr IntT denominator() const noexcept { return this->frac.denominator; }
+        /// @brief True when the stored parts are known to be in lowest terms.
+        constexpr bool isReduced() const noexcept { return this->isKnownReduced; }
+        /// @brief The value in lowest terms. Costs a GCD unless `isReduced()`.
+        /// @example Frac f = lazy.value();
+        constexpr BasicFrac<IntT> value() const noexcept;
+        /// @brief The stored parts as they are.
+        constexpr BasicFrac<IntT> raw() const noexcept { return this->frac; }
+        /// @brief Reduces the stored parts in place, so later `value()`, `hash()` and output are free.
+        constexpr void normalize() noexcept;
+        /// @brief Hash of the value, equal to `BasicFrac::hash` of the same value. `std::hash` uses this.
+        constexpr std::size_t hash() const noexcept;
+
+    public: // STATIC METHODS
+        /// @brief Compares the values of two fractions, see `BasicFrac::compare`.
+        /// @return negative if `a < b`, zero if they are equal and positive if `a > b`.
+        static constexpr int compare(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept;
+        /// @brief Converts the reduced form to a string (ie. "1/2").
+        static std::string toString(const BasicLazyFrac& frac) { return BasicFrac<IntT>::toString(frac.value()); }
+        static constexpr double toDouble(const BasicLazyFrac& frac) { return BasicFrac<IntT>::toDouble(frac.frac); }
+
+    public: // NON-THROWING API
+        // As in `BasicFrac`, every function returns `FracError::None` and writes `out` on success, leaves
+        // `out` unchanged on failure, and `out` may alias an input. A result that does not fit unreduced
+        // is reduced before `Overflow` is reported.
+
+        /// @brief Creates `n/d`, reduced only if a part reaches `REDUCE_THRESHOLD`.
+        /// @return `ZeroDivisor` if `d` is zero, `Overflow` if the sign cannot be moved to the numerator.
+        static constexpr FracError tryMake(IntT n, IntT d, BasicLazyFrac& out) noexcept;
+        static constexpr FracError tryAdd(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept;
+        static constexpr FracError trySub(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept;
+        static constexpr FracError tryMul(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept;
+        /// @return `ZeroDivisor` if `b` is zero.
+        static constexpr FracError tryDiv(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept;
+        static constexpr FracError tryNegate(const BasicLazyFrac& a, BasicLazyFrac& out) noexcept;
+
+    private: // PRIVATE FUNCTIONS
+        using Wide = typename detail::IntTraits<IntT>::Wide;
+        using TryOp = FracError (*)(const BasicLazyFrac&, const BasicLazyFrac&, BasicLazyFrac&) noexcept;
+        using FracTryOp = FracError (*)(const BasicFrac<IntT>&, const BasicFrac<IntT>&, BasicFrac<IntT>&) noexcept;
+
+        constexpr BasicLazyFrac(const BasicFrac<IntT>& frac, bool isReduced) noexcept : frac(frac), isKnownReduced(isReduced) {}
+
+        /// @brief Runs a `try*` function and raises its error.
+        static constexpr BasicLazyFrac apply(TryOp op, const BasicLazyFrac& a, const BasicLazyFrac& b);
+        static constexpr bool isEqual(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept;
+        /// @brief Adds or subtracts without a GCD. Adding an integer keeps the other operand's flag,
+        /// since `gcd(n + k*d, d) == gcd(n, d)`.
+        /// @return `Overflow` if the unreduced result does not fit.
+        static constexpr FracError addLazy(const BasicLazyFrac& a, const BasicLazyFrac& b, bool isSubtracting, BasicLazyFrac& out) noexcept;
+        /// @brief Stores a widened result with a positive denominator, reducing it only if a part
+        /// reaches `REDUCE_THRESHOLD`. Zero and integers are always reduced.
+        /// @return `Overflow` if the result does not fit even after reducing.
+        static constexpr FracError store(Wide n, Wide d, bool isReduced, BasicLazyFrac& out) noexcept;
+        /// @brief Applies the reducing `BasicFrac` operation to the reduced operands, for results the
+        /// lazy path cannot hold.
+        static constexpr FracError eager(FracTryOp op, const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept;
+
+    private: // ATTRIBUTES
+        BasicFrac<IntT> frac;
+        bool isKnownReduced;
+    };
+
+    /// @brief Lazily reduced fraction with 32-bit numerator and denominator.
+    using LazyFrac = BasicLazyFrac<int>;
+    /// @brief Lazily reduced fraction with 64-bit numerator and denominator.
+    using LazyFrac64 = BasicLazyFrac<std::int64_t>;
+#ifdef FRACLIB_HAS_INT128
+    /// @brief Lazily reduced fraction with 128-bit numerator and denominator.
+    using LazyFrac128 = BasicLazyFrac<__int128>;
+#endif
+
+    static_assert(std::is_trivially_copyable<LazyFrac>::value, "LazyFrac must stay trivially copyable.");
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>::BasicLazyFrac() noexcept : frac(), isKnownReduced(true) {}
+
+    template <typename IntT>
+    template <typename T, typename>
+    constexpr BasicLazyFrac<IntT>::BasicLazyFrac(T n) : frac(n), isKnownReduced(true) {}
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>::BasicLazyFrac(IntT n, IntT d) : frac(), isKnownReduced(true) {
+        detail::throwOnError(tryMake(n, d, *this));
+    }
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>::BasicLazyFrac(const BasicFrac<IntT>& frac) : frac(), isKnownReduced(true) {
+        detail::throwOnError(tryMake(frac.numerator, frac.denominator, *this));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>& BasicLazyFrac<IntT>::operator+=(const BasicLazyFrac& other) {
+        detail::throwOnError(tryAdd(*this, other, *this));
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>& BasicLazyFrac<IntT>::operator-=(const BasicLazyFrac& other) {
+        detail::throwOnError(trySub(*this, other, *this));
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>& BasicLazyFrac<IntT>::operator*=(const BasicLazyFrac& other) {
+        detail::throwOnError(tryMul(*this, other, *this));
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT>& BasicLazyFrac<IntT>::operator/=(const BasicLazyFrac& other) {
+        detail::throwOnError(tryDiv(*this, other, *this));
+        return *this;
+    }
+
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT> BasicLazyFrac<IntT>::operator-() const {
+        BasicLazyFrac result;
+        detail::throwOnError(tryNegate(*this, result));
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicFrac<IntT> BasicLazyFrac<IntT>::value() const noexcept {
+        BasicFrac<IntT> result = this->frac;
+        // The denominator is positive, so simplifying cannot fail
+        if (!this->isKnownReduced) BasicFrac<IntT>::trySimplify(result);
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr void BasicLazyFrac<IntT>::normalize() noexcept {
+        this->frac = this->value();
+        this->isKnownReduced = true;
+    }
+
+    template <typename IntT>
+    constexpr std::size_t BasicLazyFrac<IntT>::hash() const noexcept {
+        if (!this->isKnownReduced) return this->frac.hash();
+        return detail::hashReduced(detail::absToUnsigned(this->frac.numerator), detail::absToUnsigned(this->frac.denominator),
+            this->frac.numerator < 0);
+    }
+
+    template <typename IntT>
+    constexpr int BasicLazyFrac<IntT>::compare(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept {
+        return BasicFrac<IntT>::compare(a.frac, b.frac);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Non-Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::tryMake(IntT n, IntT d, BasicLazyFrac& out) noexcept {
+        if (d == 0) {
+            return FracError::ZeroDivisor;
+        }
+        if (d < 0) {
+            // The minimum of `IntT` has no positive counterpart, reducing first may still make room
+            BasicFrac<IntT> result(n, 1);
+            result.denominator = d;
+            const FracError error = BasicFrac<IntT>::trySimplify(result);
+            if (error != FracError::None) return error;
+            out = BasicLazyFrac(result, true);
+            return FracError::None;
+        }
+        return store(n, d, false, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::tryAdd(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept {
+        if (addLazy(a, b, false, out) == FracError::None) return FracError::None;
+        return eager(BasicFrac<IntT>::tryAdd, a, b, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::trySub(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept {
+        if (addLazy(a, b, true, out) == FracError::None) return FracError::None;
+        return eager(BasicFrac<IntT>::trySub, a, b, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::tryMul(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept {
+        Wide n = 0, d = 0;
+        if (!detail::mulWide(a.frac.numerator, b.frac.numerator, n) && !detail::mulWide(a.frac.denominator, b.frac.denominator, d) &&
+            store(n, d, false, out) == FracError::None) {
+            return FracError::None;
+        }
+        return eager(BasicFrac<IntT>::tryMul, a, b, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::tryDiv(const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept {
+        if (b.frac.numerator == 0) {
+            return FracError::ZeroDivisor;
+        }
+        Wide n = 0, d = 0;
+        if (!detail::mulWide(a.frac.numerator, b.frac.denominator, n) && !detail::mulWide(a.frac.denominator, b.frac.numerator, d) &&
+            store(n, d, false, out) == FracError::None) {
+            return FracError::None;
+        }
+        return eager(BasicFrac<IntT>::tryDiv, a, b, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::tryNegate(const BasicLazyFrac& a, BasicLazyFrac& out) noexcept {
+        // Negating keeps the parts coprime, only the minimum numerator needs reducing first
+        BasicFrac<IntT> result;
+        FracError error = BasicFrac<IntT>::tryNegate(a.frac, result);
+        if (error == FracError::None) {
+            out = BasicLazyFrac(result, a.isKnownReduced);
+            return FracError::None;
+        }
+        if (a.isKnownReduced) return error;
+        error = BasicFrac<IntT>::tryNegate(a.value(), result);
+        if (error == FracError::None) out = BasicLazyFrac(result, true);
+        return error;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT>
+    constexpr BasicLazyFrac<IntT> BasicLazyFrac<IntT>::apply(TryOp op, const BasicLazyFrac& a, const BasicLazyFrac& b) {
+        BasicLazyFrac result;
+        detail::throwOnError(op(a, b, result));
+        return result;
+    }
+
+    template <typename IntT>
+    constexpr bool BasicLazyFrac<IntT>::isEqual(const BasicLazyFrac& a, const BasicLazyFrac& b) noexcept {
+        // Two reduced fractions with positive denominators are equal only if their parts are
+        if (a.isKnownReduced && b.isKnownReduced) {
+            return a.frac.numerator == b.frac.numerator && a.frac.denominator == b.frac.denominator;
+        }
+        return a.frac == b.frac;
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::addLazy(const BasicLazyFrac& a, const BasicLazyFrac& b, bool isSubtracting, BasicLazyFrac& out) noexcept {
+        const auto combine = [isSubtracting](Wide x, Wide y, Wide& result) {
+            return isSubtracting ? detail::subOverflow(x, y, result) : detail::addOverflow(x, y, result);
+        };
+        Wide left = a.frac.numerator, right = b.frac.numerator, sum = 0, denominator = 0;
+        bool isReduced = false;
+
+        if (b.frac.denominator == 1) {
+            if (detail::mulWide(b.frac.numerator, a.frac.denominator, right)) return FracError::Overflow;
+            denominator = a.frac.denominator;
+            isReduced = a.isKnownReduced;
+        } else if (a.frac.denominator == 1) {
+            if (detail::mulWide(a.frac.numerator, b.frac.denominator, left)) return FracError::Overflow;
+            denominator = b.frac.denominator;
+            isReduced = b.isKnownReduced;
+        } else if (a.frac.denominator == b.frac.denominator) {
+            denominator = a.frac.denominator;
+        } else if (detail::mulWide(a.frac.numerator, b.frac.denominator, left) || detail::mulWide(b.frac.numerator, a.frac.denominator, right) ||
+            detail::mulWide(a.frac.denominator, b.frac.denominator, denominator)) {
+            return FracError::Overflow;
+        }
+        if (combine(left, right, sum)) return FracError::Overflow;
+        return store(sum, denominator, isReduced, out);
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::store(Wide n, Wide d, bool isReduced, BasicLazyFrac& out) noexcept {
+        if (n == 0) {
+            out = BasicLazyFrac();
+            return FracError::None;
+        }
+        if (d < 0) {
+            if (detail::subOverflow(static_cast<Wide>(0), n, n) || detail::subOverflow(static_cast<Wide>(0), d, d)) {
+                return FracError::Overflow;
+            }
+        }
+
+        constexpr Wide THRESHOLD = REDUCE_THRESHOLD;
+        if (!isReduced && d != 1 && (n >= THRESHOLD || n <= -THRESHOLD || d >= THRESHOLD)) {
+            const Wide gcd = detail::gcdOf(n, d);
+            n /= gcd;
+            d /= gcd;
+            isReduced = true;
+        }
+        if (!detail::fitsIn<IntT>(n) || !detail::fitsIn<IntT>(d)) {
+            return FracError::Overflow;
+        }
+        out.frac.numerator = static_cast<IntT>(n);
+        out.frac.denominator = static_cast<IntT>(d);
+        out.isKnownReduced = isReduced || d == 1;
+        return FracError::None;
+    }
+
+    template <typename IntT>
+    constexpr FracError BasicLazyFrac<IntT>::eager(FracTryOp op, const BasicLazyFrac& a, const BasicLazyFrac& b, BasicLazyFrac& out) noexcept {
+        BasicFrac<IntT> result;
+        const FracError error = op(a.value(), b.value(), result);
+        if (error == FracError::None) out = BasicLazyFrac(result, true);
+        return error;
+    }
+}
+
+namespace std {
+    /// @brief Hashes lazy fractions by value, consistently with `std::hash<BasicFrac<IntT>>`.
+    template <typename IntT>
+    struct hash<FracLib::BasicLazyFrac<IntT>> {
+        std::size_t operator()(const FracLib::BasicLazyFrac<IntT>& frac) const noexcept { return frac.hash(); }
+    };
+}
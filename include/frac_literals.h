@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_literals.h
+ * Description:
+ *  This header file defines the `_frac` and `_frac64` user-defined literals,
+ *  which turn fraction and decimal constants into `Frac` and `Frac64` values
+ *  at compile time.
+ *
+ *  Numeric literals (`0.125_frac`, `3_frac`) are literal operator templates
+ *  whose value is computed in a `constexpr` variable, so the parse always
+ *  happens during compilation, even in C++17. String literals
+ *  (`"3 1/2"_frac`) are `consteval` in C++20. Before C++20 they use the
+ *  GNU string literal operator template with GCC and Clang, and are plain
+ *  `constexpr` functions elsewhere, which are only guaranteed to be parsed
+ *  during compilation when they initialize a `constexpr` variable. Both
+ *  accept what `operator>>` accepts, read with `BasicFrac::tryParseExact`.
+ *  A literal that does not parse, divides by zero or does not fit exactly
+ *  is a compile error.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__cpp_consteval)
+    #define FRACLIB_CONSTEVAL consteval
+#else
+    #define FRACLIB_CONSTEVAL constexpr
+    // Before C++20, the GNU string literal operator template moves string literals to a constexpr variable too
+    #if defined(__GNUC__) || defined(__clang__)
+        #define FRACLIB_HAS_STRING_LITERAL_TEMPLATE 1
+    #endif
+#endif
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Parses a literal with `tryParseExact`, raising on failure, which is not a constant
+        /// expression and so fails the compilation.
+        template <typename IntT>
+        constexpr BasicFrac<IntT> parseLiteral(std::string_view str) {
+            BasicFrac<IntT> result;
+            throwOnError(BasicFrac<IntT>::tryParseExact(str, result));
+            return result;
+        }
+
+        /// @brief Parses the characters of a numeric literal, skipping digit separators (`1'000_frac`).
+        template <typename IntT, char... Chars>
+        constexpr BasicFrac<IntT> parseNumericLiteral() {
+            const char chars[] = {Chars...};
+            char text[sizeof...(Chars)] = {};
+            std::size_t length = 0;
+            for (const char ch : chars) {
+                if (ch != '\'') text[length++] = ch;
+            }
+            return parseLiteral<IntT>(std::string_view(text, length));
+        }
+
+#ifdef FRACLIB_HAS_STRING_LITERAL_TEMPLATE
+        /// @brief Parses the characters of a string literal.
+        template <typename IntT, typename CharT, CharT... Chars>
+        constexpr BasicFrac<IntT> parseStringLiteral() {
+            static_assert(std::is_same<CharT, char>::value, "Fraction literals must be narrow strings.");
+            const char text[] = {Chars..., '\0'};
+            return parseLiteral<IntT>(std::string_view(text, sizeof...(Chars)));
+        }
+#endif
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Literals
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Found by `using namespace FracLib;` or, on their own, `using namespace FracLib::literals;`. A leading
+    // '-' outside the quotes of a numeric literal is the constexpr unary minus: `-0.5_frac` is -1/2.
+    inline namespace literals {
+#ifdef FRACLIB_HAS_STRING_LITERAL_TEMPLATE
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        /// @brief Fraction from a decimal or integer literal, evaluated at compile time.
+        /// @example constexpr Frac eighth = 0.125_frac; // 1/8
+        template <char... Chars>
+        constexpr Frac operator""_frac() {
+            constexpr Frac value = detail::parseNumericLiteral<int, Chars...>();
+            return value;
+        }
+        /// @brief Fraction from a string literal such as "3/4", "3 1/2", "-0.125" or "1e-3".
+        /// @example Frac price = "3 1/2"_frac; // 7/2
+#ifdef FRACLIB_HAS_STRING_LITERAL_TEMPLATE
+        template <typename CharT, CharT... Chars>
+        constexpr Frac operator""_frac() {
+            constexpr Frac value = detail::parseStringLiteral<int, CharT, Chars...>();
+            return value;
+        }
+#else
+        FRACLIB_CONSTEVAL Frac operator""_frac(const char* str, std::size_t length) {
+            return detail::parseLiteral<int>(std::string_view(str, length));
+        }
+#endif
+
+        /// @brief `Frac64` from a decimal or integer literal, evaluated at compile time.
+        /// @example constexpr Frac64 tick = 0.000001_frac64; // 1/1000000
+        template <char... Chars>
+        constexpr Frac64 operator""_frac64() {
+            constexpr Frac64 value = detail::parseNumericLiteral<std::int64_t, Chars...>();
+            return value;
+        }
+        /// @brief `Frac64` from a string literal.
+#ifdef FRACLIB_HAS_STRING_LITERAL_TEMPLATE
+        template <typename CharT, CharT... Chars>
+        constexpr Frac64 operator""_frac64() {
+            constexpr Frac64 value = detail::parseStringLiteral<std::int64_t, CharT, Chars...>();
+            return value;
+        }
+#else
+        FRACLIB_CONSTEVAL Frac64 operator""_frac64(const char* str, std::size_t length) {
+            return detail::parseLiteral<std::int64_t>(std::string_view(str, length));
+        }
+#endif
+#ifdef FRACLIB_HAS_STRING_LITERAL_TEMPLATE
+    #pragma GCC diagnostic pop
+#endif
+    }
+}
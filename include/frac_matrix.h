@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_matrix.h
+ * Description:
+ *  This header file defines `FracMatrix`, a dense row-major matrix of
+ *  `Frac`, and exact `determinant`, `solve` and `inverse` functions built on
+ *  fraction-free Bareiss elimination.
+ *
+ *  Instead of eliminating with fractions, which reduces after every step
+ *  and overflows `int` quickly, each row is scaled by the lcm of its
+ *  denominators into `BigInt` integers. Bareiss elimination then keeps every
+ *  entry an integer: step `k` updates `M[i][j]` to
+ *  `(M[k][k] * M[i][j] - M[i][k] * M[k][j]) / M[k-1][k-1]`, a division that
+ *  is always exact, and entries stay bounded by minors of the input. Values
+ *  that fit in 64 bits never leave the inline fast path of `BigInt`.
+ *  Solutions are recovered with one more fraction-free back substitution, so
+ *  only the final `x = X / det` is ever reduced.
+ *
+ *  Each step updates the rows below the pivot one column block at a time, so
+ *  the block of the pivot row stays in cache while it is reused by every row,
+ *  and large steps split their rows across threads.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_big.h"
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <vector>
+
+namespace FracLib {
+    /// @brief Dense matrix of `Frac` stored contiguously in row-major order.
+    class FracMatrix {
+    public: // TYPES
+        using size_type = std::size_t;
+
+    public: // CONSTRUCTORS
+        /// @brief Creates an empty 0 x 0 matrix.
+        explicit FracMatrix(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+        /// @brief Creates a `rows` x `cols` matrix of zeros.
+        FracMatrix(size_type rows, size_type cols, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        /// @brief Creates a matrix from a list of rows.
+        /// @throws std::invalid_argument if the rows have different lengths (`FracError::SizeMismatch`).
+        /// @example FracMatrix a = {{Frac(1, 2), 3}, {Frac(-1, 4), 2}};
+        FracMatrix(std::initializer_list<std::initializer_list<Frac>> rows,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        /// @brief Copies `other` into memory from `resource`.
+        FracMatrix(const FracMatrix& other, std::pmr::memory_resource* resource);
+        FracMatrix(const FracMatrix& other) = default;
+        FracMatrix(FracMatrix&& other) noexcept = default;
+        FracMatrix& operator=(const FracMatrix& other) = default;
+        FracMatrix& operator=(FracMatrix&& other) = default;
+
+        /// @brief The `size` x `size` identity matrix.
+        static FracMatrix identity(size_type size, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    public: // ACCESSORS
+        size_type rows() const noexcept { return this->rowCount; }
+        size_type cols() const noexcept { return this->colCount; }
+        bool empty() const noexcept { return this->values.empty(); }
+        bool isSquare() const noexcept { return this->rowCount == this->colCount; }
+
+        /// @brief Element at `row`, `col`. Unchecked.
+        Frac& operator()(size_type row, size_type col) noexcept { return this->values[row * this->colCount + col]; }
+        const Frac& operator()(size_type row, size_type col) const noexcept { return this->values[row * this->colCount + col]; }
+        /// @brief First element of `row`, followed by the rest of the row.
+        Frac* row(size_type row) noexcept { return this->values.data() + row * this->colCount; }
+        const Frac* row(size_type row) const noexcept { return this->values.data() + row * this->colCount; }
+        Frac* data() noexcept { return this->values.data(); }
+        const Frac* data() const noexcept { return this->values.data(); }
+
+        std::pmr::memory_resource* resource() const noexcept { return this->values.get_allocator().resource(); }
+
+    public: // COMPARISON
+        /// @brief Same dimensions and equal values (compared with `Frac::operator==`).
+        friend bool operator==(const FracMatrix& a, const FracMatrix& b) noexcept;
+        friend bool operator!=(const FracMatrix& a, const FracMatrix& b) noexcept { return !(a == b); }
+
+    private: // ATTRIBUTES
+        size_type rowCount;
+        size_type colCount;
+        std::pmr::vector<Frac> values;
+    };
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Linear Algebra
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Results are exact. Element denominators must be non-zero. `threads` is the number of threads to
+    // use, `0` for one per hardware thread; small matrices are always eliminated on the calling thread.
+    // The `try*` forms leave `out` unchanged on failure.
+
+    /// @brief Determinant of a square matrix, which may not fit in `Frac`. The determinant of a 0 x 0
+    /// matrix is 1.
+    /// @return `SizeMismatch` if `a` is not square, `ZeroDivisor` for a zero denominator.
+    FracError tryDeterminant(const FracMatrix& a, BigFrac& out, unsigned threads = 0);
+    /// @brief Solves `a * x = b` for `x`, with one column of `x` per column of `b`.
+    /// @return `SizeMismatch` if `a` is not square or `b` has a different number of rows, `Singular` if
+    /// `a` has no inverse, `Overflow` if an element of `x` does not fit in `Frac`, `ZeroDivisor` for a
+    /// zero denominator.
+    /// @example FracMatrix x; FracLib::trySolve(a, FracMatrix{{1}, {2}}, x);
+    FracError trySolve(const FracMatrix& a, const FracMatrix& b, FracMatrix& out, unsigned threads = 0);
+    /// @brief Inverse of a square matrix, the solution of `a * x = identity`.
+    /// @return the errors of `trySolve`.
+    FracError tryInverse(const FracMatrix& a, FracMatrix& out, unsigned threads = 0);
+
+    /// @brief Determinant of a square matrix.
+    /// @throws std::invalid_argument on the errors of `tryDeterminant`.
+    /// @example BigFrac det = FracLib::determinant(a);
+    BigFrac determinant(const FracMatrix& a, unsigned threads = 0);
+    /// @brief Solves `a * x = b` for `x`.
+    /// @throws std::overflow_error or std::invalid_argument on the errors of `trySolve`.
+    FracMatrix solve(const FracMatrix& a, const FracMatrix& b, unsigned threads = 0);
+    /// @brief Inverse of a square matrix.
+    /// @throws std::overflow_error or std::invalid_argument on the errors of `tryInverse`.
+    FracMatrix inverse(const FracMatrix& a, unsigned threads = 0);
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_matrix.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_matrix_impl.h"
+#endif
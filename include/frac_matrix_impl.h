@@ -0,0 +1,264 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_matrix_impl.h
+ * Description:
+ *  This header file implements `FracMatrix` and the Bareiss elimination
+ *  behind `determinant`, `solve` and `inverse` declared in `frac_matrix.h`.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by
+ *  `frac_matrix.h`. Otherwise `src/frac_matrix.cpp` compiles it into the
+ *  static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_matrix.h"
+#include "frac_parallel.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Columns updated together, so a block of the pivot row is reused by every row while in cache.
+        constexpr std::size_t MATRIX_BLOCK = 64;
+        /// @brief Smallest number of entry updates worth a thread of its own.
+        constexpr std::size_t MATRIX_MIN_CHUNK = 1 << 12;
+
+        /// @brief Calls `fn(begin, end)` on `[first, last)`, split into one contiguous chunk per thread when
+        /// the `work` (entry updates) of the whole range is large enough.
+        template <typename Fn>
+        void forEachChunk(std::size_t first, std::size_t last, std::size_t work, unsigned threads, const Fn& fn) {
+            const std::size_t count = last - first;
+            std::size_t chunks = chunkCount(work, MATRIX_MIN_CHUNK, threads);
+            if (chunks > count) chunks = count;
+            if (chunks < 2) {
+                fn(first, last);
+                return;
+            }
+            runChunks(chunks, [&](std::size_t chunk) {
+                fn(first + count * chunk / chunks, first + count * (chunk + 1) / chunks);
+            });
+        }
+
+        /// @brief Writes `[a | b]` into the row-major integer matrix `m`, every row multiplied by the lcm of
+        /// its denominators, and multiplies `scale` by each lcm. `b` may be null.
+        /// @return `ZeroDivisor` if an element has a zero denominator.
+        FRACLIB_INLINE FracError toIntegerRows(const FracMatrix& a, const FracMatrix* b, std::vector<BigInt>& m, BigInt& scale) {
+            const std::size_t extra = b != nullptr ? b->cols() : 0;
+            const std::size_t cols = a.cols() + extra;
+            m.assign(a.rows() * cols, BigInt());
+            for (std::size_t i = 0; i < a.rows(); i++) {
+                const Frac* left = a.row(i);
+                const Frac* right = b != nullptr ? b->row(i) : nullptr;
+                const auto element = [&](std::size_t j) -> const Frac& { return j < a.cols() ? left[j] : right[j - a.cols()]; };
+
+                BigInt lcm(1);
+                for (std::size_t j = 0; j < cols; j++) {
+                    const int denominator = element(j).denominator;
+                    if (denominator == 0) return FracError::ZeroDivisor;
+                    if (denominator == 1 || denominator == -1) continue;
+                    const BigInt magnitude = BigInt::abs(BigInt(denominator));
+                    lcm = lcm / BigInt::gcd(lcm, magnitude) * magnitude;
+                }
+                BigInt* row = m.data() + i * cols;
+                for (std::size_t j = 0; j < cols; j++) {
+                    const Frac& value = element(j);
+                    row[j] = value.denominator == 1 ? BigInt(value.numerator) * lcm : BigInt(value.numerator) * (lcm / BigInt(value.denominator));
+                }
+                scale = scale * lcm;
+            }
+            return FracError::None;
+        }
+
+        /// @brief Bareiss elimination of the first `n` columns of the `n` x `cols` integer matrix `m`, which
+        /// leaves an upper triangle whose last diagonal entry is the determinant of the (row-swapped) input.
+        /// Entries below the diagonal are left stale.
+        /// @param sign receives -1 after an odd number of row swaps, 1 otherwise.
+        /// @return false if the first `n` columns are singular.
+        FRACLIB_INLINE bool eliminate(std::vector<BigInt>& m, std::size_t n, std::size_t cols, unsigned threads, int& sign) {
+            sign = 1;
+            BigInt previous(1);
+            for (std::size_t k = 0; k < n; k++) {
+                std::size_t pivotRow = k;
+                while (pivotRow < n && m[pivotRow * cols + k].isZero()) pivotRow++;
+                if (pivotRow == n) return false;
+                if (pivotRow != k) {
+                    std::swap_ranges(m.begin() + static_cast<std::ptrdiff_t>(k * cols + k), m.begin() + static_cast<std::ptrdiff_t>((k + 1) * cols),
+                        m.begin() + static_cast<std::ptrdiff_t>(pivotRow * cols + k));
+                    sign = -sign;
+                }
+
+                const BigInt* pivot = m.data() + k * cols;
+                const bool isDividing = previous != BigInt(1);
+                const auto update = [&](std::size_t firstRow, std::size_t lastRow) {
+                    for (std::size_t block = k + 1; block < cols; block += MATRIX_BLOCK) {
+                        const std::size_t blockEnd = std::min(block + MATRIX_BLOCK, cols);
+                        for (std::size_t i = firstRow; i < lastRow; i++) {
+                            BigInt* row = m.data() + i * cols;
+                            const BigInt& factor = row[k];
+                            for (std::size_t j = block; j < blockEnd; j++) {
+                                // (pivot * m[i][j] - m[i][k] * m[k][j]) / previous pivot, always exact
+                                BigInt value = pivot[k] * row[j];
+                                if (!factor.isZero()) value = value - factor * pivot[j];
+                                row[j] = isDividing ? value / previous : std::move(value);
+                            }
+                        }
+                    }
+                };
+                forEachChunk(k + 1, n, (n - k - 1) * (cols - k - 1), threads, update);
+                previous = pivot[k];
+            }
+            return true;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracMatrix::FracMatrix(std::pmr::memory_resource* resource) noexcept : rowCount(0), colCount(0), values(resource) {}
+
+    FRACLIB_INLINE FracMatrix::FracMatrix(size_type rows, size_type cols, std::pmr::memory_resource* resource) :
+        rowCount(rows), colCount(cols), values(rows * cols, Frac(), resource) {}
+
+    FRACLIB_INLINE FracMatrix::FracMatrix(std::initializer_list<std::initializer_list<Frac>> rows, std::pmr::memory_resource* resource) :
+        rowCount(rows.size()), colCount(rows.size() == 0 ? 0 : rows.begin()->size()), values(resource) {
+        this->values.reserve(this->rowCount * this->colCount);
+        for (const std::initializer_list<Frac>& row : rows) {
+            if (row.size() != this->colCount) detail::raise(FracError::SizeMismatch);
+            this->values.insert(this->values.end(), row.begin(), row.end());
+        }
+    }
+
+    FRACLIB_INLINE FracMatrix::FracMatrix(const FracMatrix& other, std::pmr::memory_resource* resource) :
+        rowCount(other.rowCount), colCount(other.colCount), values(other.values, resource) {}
+
+    FRACLIB_INLINE FracMatrix FracMatrix::identity(size_type size, std::pmr::memory_resource* resource) {
+        FracMatrix result(size, size, resource);
+        for (size_type i = 0; i < size; i++) result(i, i) = Frac(1);
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Comparison
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE bool operator==(const FracMatrix& a, const FracMatrix& b) noexcept {
+        if (a.rowCount != b.rowCount || a.colCount != b.colCount) return false;
+        for (FracMatrix::size_type i = 0; i < a.values.size(); i++) {
+            if (Frac::compare(a.values[i], b.values[i]) != 0) return false;
+        }
+        return true;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Linear Algebra
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracError tryDeterminant(const FracMatrix& a, BigFrac& out, unsigned threads) {
+        if (!a.isSquare()) return FracError::SizeMismatch;
+        if (a.rows() == 0) {
+            out = BigFrac(1);
+            return FracError::None;
+        }
+
+        std::vector<BigInt> m;
+        BigInt scale(1);
+        const FracError error = detail::toIntegerRows(a, nullptr, m, scale);
+        if (error != FracError::None) return error;
+        int sign = 1;
+        const std::size_t n = a.rows();
+        if (!detail::eliminate(m, n, n, detail::threadCount(threads), sign)) {
+            out = BigFrac(0);
+            return FracError::None;
+        }
+        const BigInt& last = m[n * n - 1];
+        // The rows were scaled by `scale` in total, which divides back out
+        out = BigFrac(sign < 0 ? -last : last, scale);
+        return FracError::None;
+    }
+
+    FRACLIB_INLINE FracError trySolve(const FracMatrix& a, const FracMatrix& b, FracMatrix& out, unsigned threads) {
+        if (!a.isSquare() || a.rows() != b.rows()) return FracError::SizeMismatch;
+        if (a.rows() == 0) {
+            FracMatrix result(0, b.cols(), out.resource());
+            out = std::move(result);
+            return FracError::None;
+        }
+        const std::size_t n = a.rows();
+        const std::size_t cols = n + b.cols();
+        threads = detail::threadCount(threads);
+
+        std::vector<BigInt> m;
+        BigInt scale(1);
+        FracError error = detail::toIntegerRows(a, &b, m, scale);
+        if (error != FracError::None) return error;
+        int sign = 1;
+        if (!detail::eliminate(m, n, cols, threads, sign)) return FracError::Singular;
+
+        // With d the last pivot, X = d * x is an integer vector (Cramer's rule) that solves U X = d * b' by
+        // exact divisions, so each element of x is reduced once at the end as X / d
+        FracMatrix result(n, b.cols(), out.resource());
+        std::vector<FracError> errors(b.cols(), FracError::None);
+        const auto substitute = [&](std::size_t firstColumn, std::size_t lastColumn) {
+            const BigInt& d = m[(n - 1) * cols + (n - 1)];
+            std::vector<BigInt> x(n);
+            for (std::size_t c = firstColumn; c < lastColumn; c++) {
+                for (std::size_t i = n; i-- > 0;) {
+                    const BigInt* row = m.data() + i * cols;
+                    BigInt value = d * row[n + c];
+                    for (std::size_t j = i + 1; j < n; j++) {
+                        if (!row[j].isZero()) value = value - row[j] * x[j];
+                    }
+                    x[i] = value / row[i];
+                }
+                for (std::size_t i = 0; i < n && errors[c] == FracError::None; i++) {
+                    errors[c] = BigFrac(x[i], d).tryConvert(result(i, c));
+                }
+            }
+        };
+        detail::forEachChunk(0, b.cols(), n * n * b.cols(), threads, substitute);
+
+        for (FracError columnError : errors) {
+            if (columnError != FracError::None) return columnError;
+        }
+        out = std::move(result);
+        return FracError::None;
+    }
+
+    FRACLIB_INLINE FracError tryInverse(const FracMatrix& a, FracMatrix& out, unsigned threads) {
+        if (!a.isSquare()) return FracError::SizeMismatch;
+        return trySolve(a, FracMatrix::identity(a.rows()), out, threads);
+    }
+
+    FRACLIB_INLINE BigFrac determinant(const FracMatrix& a, unsigned threads) {
+        BigFrac result;
+        detail::throwOnError(tryDeterminant(a, result, threads));
+        return result;
+    }
+
+    FRACLIB_INLINE FracMatrix solve(const FracMatrix& a, const FracMatrix& b, unsigned threads) {
+        FracMatrix result;
+        detail::throwOnError(trySolve(a, b, result, threads));
+        return result;
+    }
+
+    FRACLIB_INLINE FracMatrix inverse(const FracMatrix& a, unsigned threads) {
+        FracMatrix result;
+        detail::throwOnError(tryInverse(a, result, threads));
+        return result;
+    }
+}
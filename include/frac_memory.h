@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_memory.h
+ * Description:
+ *  This header file defines `FracArena`, a monotonic `std::pmr::memory_resource`
+ *  for short-lived fraction workloads such as the temporaries of one request.
+ *
+ *  `FracArray`, `BigInt` and `BigFrac` take a `std::pmr::memory_resource`, so
+ *  their buffers and limbs can come from an arena. Allocation bumps a pointer
+ *  in the current block and deallocation is a no-op; everything is freed at
+ *  once by `reset()`. Unlike `std::pmr::monotonic_buffer_resource`, a reset
+ *  keeps the memory: an arena that needed one block is rewound, and one that
+ *  needed several replaces them with a single block of their combined size,
+ *  so after the first request a workload of the same size makes no upstream
+ *  calls at all.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include <cstddef>
+#include <memory_resource>
+
+namespace FracLib {
+    /// @brief Monotonic arena: bump-pointer allocation, no-op deallocation and a `reset()` that frees every
+    /// allocation at once while keeping the memory for the next use. Not thread-safe, use one arena per thread.
+    /// Objects allocated from the arena must not be used after `reset()`, `release()` or its destruction.
+    class FracArena : public std::pmr::memory_resource {
+    public: // CONSTANTS
+        /// @brief Size of the first block when none is given.
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    public: // CONSTRUCTORS
+        /// @brief Creates an empty arena. The first block of `blockSize` bytes is taken from `upstream` on the
+        /// first allocation, and every further block is twice the size of the previous one.
+        /// @example FracArena arena; FracArray values(1000, &arena);
+        explicit FracArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE,
+            std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+        FracArena(const FracArena& other) = delete;
+        FracArena& operator=(const FracArena& other) = delete;
+        /// @brief Returns every block to the upstream resource.
+        ~FracArena() override;
+
+    public: // METHODS
+        /// @brief Frees every allocation. The memory is kept: a single block is rewound, several blocks are
+        /// returned upstream and replaced by one block of their combined size on the next allocation.
+        void reset() noexcept;
+        /// @brief Frees every allocation and returns all memory to the upstream resource.
+        void release() noexcept;
+        /// @brief Bytes handed out since the last reset, without alignment padding.
+        std::size_t bytesUsed() const noexcept { return this->usedBytes; }
+        /// @brief Bytes currently held from the upstream resource.
+        std::size_t bytesReserved() const noexcept { return this->reservedBytes; }
+        std::pmr::memory_resource* upstream() const noexcept { return this->upstreamResource; }
+
+    protected: // MEMORY RESOURCE
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        /// @brief Does nothing, memory is only reclaimed by `reset()` and `release()`.
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) noexcept override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private: // PRIVATE FUNCTIONS
+        /// @brief Header at the start of every block, linking it to the previously allocated one.
+        struct Block {
+            Block* previous;
+            std::size_t size;
+        };
+        /// @brief Takes a new block with room for at least `bytes` past its header.
+        void addBlock(std::size_t bytes);
+
+    private: // ATTRIBUTES
+        std::pmr::memory_resource* upstreamResource;
+        std::size_t nextBlockSize;  // size of the next block taken from upstream
+        Block* current;             // most recent block, null before the first allocation
+        char* cursor;               // first free byte of `current`
+        char* end;                  // end of `current`
+        std::size_t usedBytes;
+        std::size_t reservedBytes;
+    };
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_memory.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_memory_impl.h"
+#endif
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_memory_impl.h
+ * Description:
+ *  Definitions of `FracArena` declared in frac_memory.h. Included by
+ *  frac_memory.h in header-only mode and compiled once into the static
+ *  library by src/frac_memory.cpp otherwise.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_memory.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE FracArena::FracArena(std::size_t blockSize, std::pmr::memory_resource* upstream) noexcept :
+        upstreamResource(upstream), nextBlockSize(std::max(blockSize, sizeof(Block) * 2)), current(nullptr),
+        cursor(nullptr), end(nullptr), usedBytes(0), reservedBytes(0) {}
+
+    FRACLIB_INLINE FracArena::~FracArena() {
+        this->release();
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void FracArena::reset() noexcept {
+        this->usedBytes = 0;
+        if (this->current == nullptr) return;
+        if (this->current->previous == nullptr) {
+            this->cursor = reinterpret_cast<char*>(this->current + 1);
+            return;
+        }
+        // Several blocks: the next allocation takes one block as large as all of them
+        const std::size_t combined = this->reservedBytes;
+        this->release();
+        this->nextBlockSize = combined;
+    }
+
+    FRACLIB_INLINE void FracArena::release() noexcept {
+        while (this->current != nullptr) {
+            Block* previous = this->current->previous;
+            this->upstreamResource->deallocate(this->current, this->current->size, alignof(std::max_align_t));
+            this->current = previous;
+        }
+        this->cursor = nullptr;
+        this->end = nullptr;
+        this->usedBytes = 0;
+        this->reservedBytes = 0;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Memory Resource
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void* FracArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        const auto padding = [alignment](const char* pointer) {
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+            return static_cast<std::size_t>((alignment - address % alignment) % alignment);
+        };
+        if (this->current == nullptr || static_cast<std::size_t>(this->end - this->cursor) < padding(this->cursor) + bytes) {
+            this->addBlock(bytes + alignment);
+        }
+        char* result = this->cursor + padding(this->cursor);
+        this->cursor = result + bytes;
+        this->usedBytes += bytes;
+        return result;
+    }
+
+    FRACLIB_INLINE void FracArena::do_deallocate(void*, std::size_t, std::size_t) noexcept {}
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void FracArena::addBlock(std::size_t bytes) {
+        // Requests larger than the next block get a block of their own size
+        const std::size_t size = std::max(this->nextBlockSize, bytes + sizeof(Block));
+        Block* block = static_cast<Block*>(this->upstreamResource->allocate(size, alignof(std::max_align_t)));
+        block->previous = this->current;
+        block->size = size;
+        this->current = block;
+        this->cursor = reinterpret_cast<char*>(block + 1);
+        this->end = reinterpret_cast<char*>(block) + size;
+        this->reservedBytes += size;
+        this->nextBlockSize *= 2;
+    }
+}
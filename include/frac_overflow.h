@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_overflow.h
+ * Description:
+ *  This header file defines the checked integer primitives every `BasicFrac`
+ *  operator uses to detect overflow. Each primitive performs the operation
+ *  and reports whether the exact result was representable, without ever
+ *  executing a signed overflow (which is undefined behaviour and lets the
+ *  optimizer delete after-the-fact checks).
+ *
+ *  GCC and Clang map these to `__builtin_*_overflow`, which compile to the
+ *  arithmetic instruction plus a flag test. Other compilers (MSVC) widen to
+ *  a larger type when one exists, or fall back to range checks done before
+ *  the operation.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_traits.h"
+#include "frac_stats.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define FRACLIB_HAS_BUILTIN_OVERFLOW 1
+#endif
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Computes `a * b` into `result`.
+        /// @return true if the product overflowed (`result` is then unspecified).
+        template <typename T>
+        constexpr bool mulOverflow(T a, T b, T& result) {
+#ifdef FRACLIB_HAS_BUILTIN_OVERFLOW
+            return countOverflow(__builtin_mul_overflow(a, b, &result));
+#else
+            if constexpr (IntTraits<T>::isWidened) {
+                using Wide = typename IntTraits<T>::Wide;
+                const Wide wide = static_cast<Wide>(a) * static_cast<Wide>(b);
+                result = static_cast<T>(wide);
+                return countOverflow(!fitsIn<T>(wide));
+            } else {
+                // Range checks done before multiplying so no signed overflow is executed
+                constexpr T max = IntTraits<T>::max;
+                constexpr T min = IntTraits<T>::min;
+                bool overflow = false;
+                if (a > 0) {
+                    overflow = (b > 0) ? (a > max / b) : (b < min / a);
+                } else if (a < 0) {
+                    overflow = (b > 0) ? (a < min / b) : (b != 0 && a < max / b);
+                }
+                if (!overflow) result = a * b;
+                return countOverflow(overflow);
+            }
+#endif
+        }
+
+        /// @brief Computes `a + b` into `result`.
+        /// @return true if the sum overflowed (`result` is then unspecified).
+        template <typename T>
+        constexpr bool addOverflow(T a, T b, T& result) {
+#ifdef FRACLIB_HAS_BUILTIN_OVERFLOW
+            return countOverflow(__builtin_add_overflow(a, b, &result));
+#else
+            if ((b > 0 && a > IntTraits<T>::max - b) || (b < 0 && a < IntTraits<T>::min - b)) return countOverflow(true);
+            result = a + b;
+            return false;
+#endif
+        }
+
+        /// @brief Computes `a - b` into `result`.
+        /// @return true if the difference overflowed (`result` is then unspecified).
+        template <typename T>
+        constexpr bool subOverflow(T a, T b, T& result) {
+#ifdef FRACLIB_HAS_BUILTIN_OVERFLOW
+            return countOverflow(__builtin_sub_overflow(a, b, &result));
+#else
+            if ((b < 0 && a > IntTraits<T>::max + b) || (b > 0 && a < IntTraits<T>::min + b)) return countOverflow(true);
+            result = a - b;
+            return false;
+#endif
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_parallel.h
+ * Description:
+ *  This header file defines the fan-out shared by the multithreaded parts
+ *  of the library (reductions, sorting, text ingestion and matrices): how
+ *  many threads a call may use, how many chunks a range is split into, and
+ *  how those chunks are run on `std::thread` workers.
+ *
+ *  This file is included by the headers that need it and should not be
+ *  included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-15-2026
+ * Last Modified: 10-15-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_error.h"
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#ifdef FRACLIB_HAS_EXCEPTIONS
+    #include <system_error>
+#endif
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Number of threads to use for `threads`, `0` meaning one per hardware thread.
+        inline unsigned threadCount(unsigned threads) noexcept {
+            if (threads == 0) threads = std::thread::hardware_concurrency();
+            return threads == 0 ? 1 : threads;
+        }
+
+        /// @brief Number of chunks to split `work` into: one per `minChunk` of work, at most one per
+        /// thread (see `threadCount`) and at least one.
+        inline std::size_t chunkCount(std::size_t work, std::size_t minChunk, unsigned threads) noexcept {
+            const std::size_t limit = threadCount(threads);
+            const std::size_t chunks = work / minChunk;
+            return chunks < 1 ? 1 : (chunks > limit ? limit : chunks);
+        }
+
+        /// @brief Runs `fn(chunk)` for every chunk, chunk 0 on the calling thread and one
+        /// `std::thread` for each other chunk. If a thread cannot be started its chunk runs here too.
+        template <typename Fn>
+        void runChunks(std::size_t chunks, const Fn& fn) {
+            if (chunks == 0) return;
+            std::vector<std::thread> workers;
+            workers.reserve(chunks - 1);
+            for (std::size_t chunk = 1; chunk < chunks; chunk++) {
+#ifdef FRACLIB_HAS_EXCEPTIONS
+                try {
+                    workers.emplace_back(fn, chunk);
+                } catch (const std::system_error&) {
+                    fn(chunk);
+                }
+#else
+                workers.emplace_back(fn, chunk);
+#endif
+            }
+            fn(0);
+            for (std::thread& worker : workers) worker.join();
+        }
+    }
+}
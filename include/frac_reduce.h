@@ -0,0 +1,281 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_reduce.h
+ * Description:
+ *  This header file defines exact parallel reductions over ranges of
+ *  fractions: `reduceSum`, `reduceProduct` and `dot`, for random-access
+ *  iterator ranges of any `BasicFrac` and for `FracArray`.
+ *
+ *  A left-to-right `+=` loop grows the denominator with every term and
+ *  overflows long before the result itself would. The reductions instead
+ *  combine values pairwise in a balanced tree, so operands at every level
+ *  are of similar size, and each level's results are in lowest terms. The
+ *  range is split into one contiguous chunk per thread, every chunk is
+ *  reduced on its own `std::thread`, and the chunk results are combined by
+ *  the same tree. Values are promoted to `ResultFrac` (by default the widest
+ *  `BasicFrac` the compiler supports) before they are combined.
+ *
+ *  Because fraction arithmetic is exact and associative, the result does
+ *  not depend on the number of threads (only whether an intermediate value
+ *  overflows can, since the tree shape follows the chunks).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_array.h"
+#include "frac_parallel.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Widest fraction type available, the default accumulator of the reductions.
+#ifdef FRACLIB_HAS_INT128
+        using WidestFrac = BasicFrac<__int128>;
+#else
+        using WidestFrac = BasicFrac<std::int64_t>;
+#endif
+
+        /// @brief Smallest number of elements worth a thread of its own.
+        constexpr std::size_t REDUCE_MIN_CHUNK = 1 << 14;
+
+        /// @brief Reduces elements `[first, first + count)` (`count > 0`) as a balanced binary tree.
+        /// `leaf(i, out)` loads element `i` into `out`, `combine(a, b, out)` merges two subtrees.
+        template <typename ResultFrac, typename Leaf, typename Combine>
+        FracError reduceTree(std::size_t first, std::size_t count, const Leaf& leaf, const Combine& combine, ResultFrac& out) noexcept {
+            if (count == 1) return leaf(first, out);
+
+            const std::size_t half = count / 2;
+            ResultFrac lhs, rhs;
+            FracError error = reduceTree(first, half, leaf, combine, lhs);
+            if (error != FracError::None) return error;
+            error = reduceTree(first + half, count - half, leaf, combine, rhs);
+            if (error != FracError::None) return error;
+            return combine(lhs, rhs, out);
+        }
+
+        /// @brief Splits `count` elements into one chunk per thread, reduces every chunk with
+        /// `reduceTree` and combines the chunk results the same way.
+        /// @param threads number of threads, `0` for one per hardware thread.
+        template <typename ResultFrac, typename Leaf, typename Combine>
+        FracError parallelReduce(std::size_t count, ResultFrac identity, const Leaf& leaf, const Combine& combine,
+            unsigned threads, ResultFrac& out) {
+            if (count == 0) {
+                out = identity;
+                return FracError::None;
+            }
+
+            const std::size_t chunks = chunkCount(count, REDUCE_MIN_CHUNK, threads);
+            if (chunks < 2) return reduceTree(0, count, leaf, combine, out);
+
+            std::vector<ResultFrac> partials(chunks);
+            std::vector<FracError> errors(chunks, FracError::None);
+            const auto runChunk = [&](std::size_t chunk) {
+                const std::size_t begin = count * chunk / chunks;
+                const std::size_t end = count * (chunk + 1) / chunks;
+                errors[chunk] = reduceTree(begin, end - begin, leaf, combine, partials[chunk]);
+            };
+            runChunks(chunks, runChunk);
+
+            for (FracError error : errors) {
+                if (error != FracError::None) return error;
+            }
+            const auto partial = [&partials](std::size_t i, ResultFrac& value) {
+                value = partials[i];
+                return FracError::None;
+            };
+            return reduceTree(0, chunks, partial, combine, out);
+        }
+
+        /// @brief Loads a fraction of any width into `out`, promoted and in lowest terms.
+        /// Inputs no wider than `ResultFrac` are widened first and reduced there, where every sign can be
+        /// normalized. Wider inputs are reduced in their own type before they are narrowed.
+        template <typename ResultFrac, typename IntT>
+        FracError promote(const BasicFrac<IntT>& value, ResultFrac& out) noexcept {
+            using ResultInt = typename ResultFrac::value_type;
+            if constexpr (sizeof(IntT) <= sizeof(ResultInt)) {
+                ResultFrac result;
+                result.numerator = static_cast<ResultInt>(value.numerator);
+                result.denominator = static_cast<ResultInt>(value.denominator);
+                const FracError error = ResultFrac::trySimplify(result);
+                if (error == FracError::None) out = result;
+                return error;
+            }
+
+            BasicFrac<IntT> reduced;
+            reduced.numerator = value.numerator;
+            reduced.denominator = value.denominator;
+            const bool isReduced = BasicFrac<IntT>::trySimplify(reduced) == FracError::None;
+
+            ResultFrac result;
+            FracError error = ResultFrac::tryConvert(isReduced ? reduced : value, result);
+            if (error == FracError::None && !isReduced) error = ResultFrac::trySimplify(result);
+            if (error == FracError::None) out = result;
+            return error;
+        }
+
+        template <typename ResultFrac>
+        FracError addNodes(const ResultFrac& a, const ResultFrac& b, ResultFrac& out) noexcept {
+            return ResultFrac::tryAdd(a, b, out);
+        }
+
+        template <typename ResultFrac>
+        FracError mulNodes(const ResultFrac& a, const ResultFrac& b, ResultFrac& out) noexcept {
+            return ResultFrac::tryMul(a, b, out);
+        }
+
+        template <typename Iterator>
+        constexpr void requireRandomAccess() {
+            static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                "FracLib reductions require random-access iterators.");
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Non-Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Every function below returns `FracError::None` and writes `out` on success. On failure the
+    // error is returned and `out` is left unchanged. `threads` is the number of threads to use,
+    // `0` for one per hardware thread; small ranges are always reduced on the calling thread.
+
+    /// @brief Exact sum of `[first, last)`, `0` for an empty range.
+    /// @tparam ResultFrac accumulator and result type, the widest `BasicFrac` by default.
+    /// @return `Overflow` if a partial sum does not fit in `ResultFrac`.
+    /// @example Frac128 total; FracError error = FracLib::tryReduceSum(values.begin(), values.end(), total);
+    template <typename ResultFrac = detail::WidestFrac, typename Iterator>
+    FracError tryReduceSum(Iterator first, Iterator last, ResultFrac& out, unsigned threads = 0) {
+        detail::requireRandomAccess<Iterator>();
+        const auto leaf = [first](std::size_t i, ResultFrac& value) { return detail::promote(first[i], value); };
+        return detail::parallelReduce(static_cast<std::size_t>(last - first), ResultFrac(0), leaf, detail::addNodes<ResultFrac>, threads, out);
+    }
+
+    /// @brief Exact product of `[first, last)`, `1` for an empty range.
+    /// @return `Overflow` if a partial product does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac, typename Iterator>
+    FracError tryReduceProduct(Iterator first, Iterator last, ResultFrac& out, unsigned threads = 0) {
+        detail::requireRandomAccess<Iterator>();
+        const auto leaf = [first](std::size_t i, ResultFrac& value) { return detail::promote(first[i], value); };
+        return detail::parallelReduce(static_cast<std::size_t>(last - first), ResultFrac(1), leaf, detail::mulNodes<ResultFrac>, threads, out);
+    }
+
+    /// @brief Exact dot product `sum(a[i] * b[i])` of `[firstA, lastA)` and the range starting at `firstB`.
+    /// @return `Overflow` if a product or partial sum does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac, typename IteratorA, typename IteratorB>
+    FracError tryDot(IteratorA firstA, IteratorA lastA, IteratorB firstB, ResultFrac& out, unsigned threads = 0) {
+        detail::requireRandomAccess<IteratorA>();
+        detail::requireRandomAccess<IteratorB>();
+        const auto leaf = [firstA, firstB](std::size_t i, ResultFrac& value) {
+            ResultFrac a, b;
+            FracError error = detail::promote(firstA[i], a);
+            if (error == FracError::None) error = detail::promote(firstB[i], b);
+            if (error == FracError::None) error = ResultFrac::tryMul(a, b, value);
+            return error;
+        };
+        return detail::parallelReduce(static_cast<std::size_t>(lastA - firstA), ResultFrac(0), leaf, detail::addNodes<ResultFrac>, threads, out);
+    }
+
+    /// @brief Exact sum of every element of `values`.
+    template <typename ResultFrac = detail::WidestFrac>
+    FracError tryReduceSum(FracArrayView values, ResultFrac& out, unsigned threads = 0) {
+        const auto leaf = [&values](std::size_t i, ResultFrac& value) { return detail::promote(values.get(i), value); };
+        return detail::parallelReduce(values.size(), ResultFrac(0), leaf, detail::addNodes<ResultFrac>, threads, out);
+    }
+
+    /// @brief Exact product of every element of `values`.
+    template <typename ResultFrac = detail::WidestFrac>
+    FracError tryReduceProduct(FracArrayView values, ResultFrac& out, unsigned threads = 0) {
+        const auto leaf = [&values](std::size_t i, ResultFrac& value) { return detail::promote(values.get(i), value); };
+        return detail::parallelReduce(values.size(), ResultFrac(1), leaf, detail::mulNodes<ResultFrac>, threads, out);
+    }
+
+    /// @brief Exact dot product of two arrays.
+    /// @return `SizeMismatch` if the arrays have different lengths.
+    template <typename ResultFrac = detail::WidestFrac>
+    FracError tryDot(FracArrayView a, FracArrayView b, ResultFrac& out, unsigned threads = 0) {
+        if (a.size() != b.size()) return FracError::SizeMismatch;
+        const auto leaf = [&a, &b](std::size_t i, ResultFrac& value) {
+            ResultFrac lhs, rhs;
+            FracError error = detail::promote(a.get(i), lhs);
+            if (error == FracError::None) error = detail::promote(b.get(i), rhs);
+            if (error == FracError::None) error = ResultFrac::tryMul(lhs, rhs, value);
+            return error;
+        };
+        return detail::parallelReduce(a.size(), ResultFrac(0), leaf, detail::addNodes<ResultFrac>, threads, out);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Throwing API
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief Exact sum of `[first, last)`.
+    /// @throws std::overflow_error if a partial sum does not fit in `ResultFrac`.
+    /// @example Frac128 total = FracLib::reduceSum(values.begin(), values.end());
+    template <typename ResultFrac = detail::WidestFrac, typename Iterator>
+    ResultFrac reduceSum(Iterator first, Iterator last, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryReduceSum(first, last, result, threads));
+        return result;
+    }
+
+    /// @brief Exact product of `[first, last)`.
+    /// @throws std::overflow_error if a partial product does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac, typename Iterator>
+    ResultFrac reduceProduct(Iterator first, Iterator last, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryReduceProduct(first, last, result, threads));
+        return result;
+    }
+
+    /// @brief Exact dot product of `[firstA, lastA)` and the range starting at `firstB`.
+    /// @throws std::overflow_error if a product or partial sum does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac, typename IteratorA, typename IteratorB>
+    ResultFrac dot(IteratorA firstA, IteratorA lastA, IteratorB firstB, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryDot(firstA, lastA, firstB, result, threads));
+        return result;
+    }
+
+    /// @brief Exact sum of every element of `values`.
+    /// @throws std::overflow_error if a partial sum does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac>
+    ResultFrac reduceSum(FracArrayView values, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryReduceSum(values, result, threads));
+        return result;
+    }
+
+    /// @brief Exact product of every element of `values`.
+    /// @throws std::overflow_error if a partial product does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac>
+    ResultFrac reduceProduct(FracArrayView values, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryReduceProduct(values, result, threads));
+        return result;
+    }
+
+    /// @brief Exact dot product of two arrays.
+    /// @throws std::invalid_argument if the arrays have different lengths.
+    /// @throws std::overflow_error if a product or partial sum does not fit in `ResultFrac`.
+    template <typename ResultFrac = detail::WidestFrac>
+    ResultFrac dot(FracArrayView a, FracArrayView b, unsigned threads = 0) {
+        ResultFrac result;
+        detail::throwOnError(tryDot(a, b, result, threads));
+        return result;
+    }
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_simd.h
+ * Description:
+ *  This header file selects the SIMD instruction set used by the batch
+ *  kernels (`FracArray` and `Frac::SimplifyBatch`).
+ *
+ *  With GCC or Clang on x86 the AVX2 and AVX-512 kernels are always compiled
+ *  (through `target` attributes, independent of `-march`) and the widest one
+ *  the CPU supports is chosen the first time a kernel runs, so one binary
+ *  uses AVX-512 on newer machines and AVX2 or the scalar loop on older ones.
+ *  Other compilers use the widest set enabled at compile time (`__AVX2__`,
+ *  `__AVX512F__`). On AArch64 NEON is always available and always used.
+ *
+ *  This file is included by `frac_kernels.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    // Runtime dispatch, every x86 kernel is compiled
+    #define FRACLIB_SIMD_DISPATCH 1
+    #define FRACLIB_SIMD_AVX2 1
+    #define FRACLIB_SIMD_AVX512 1
+    #define FRACLIB_TARGET_AVX2 __attribute__((target("avx2")))
+    #define FRACLIB_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512vl")))
+    #include <immintrin.h>
+#elif defined(_M_X64) && defined(__AVX2__)
+    // Compile-time selection (ie. MSVC with /arch:AVX2 or /arch:AVX512)
+    #define FRACLIB_SIMD_AVX2 1
+    #if defined(__AVX512F__) && defined(__AVX512VL__)
+        #define FRACLIB_SIMD_AVX512 1
+    #endif
+    #define FRACLIB_TARGET_AVX2
+    #define FRACLIB_TARGET_AVX512
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define FRACLIB_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Instruction set a batch kernel runs with.
+        enum class SimdLevel { Scalar, Avx2, Avx512, Neon };
+
+        /// @brief Name of `level` ("scalar", "avx2", "avx512" or "neon").
+        constexpr const char* simdLevelName(SimdLevel level) noexcept {
+            switch (level) {
+                case SimdLevel::Avx2: return "avx2";
+                case SimdLevel::Avx512: return "avx512";
+                case SimdLevel::Neon: return "neon";
+                default: return "scalar";
+            }
+        }
+
+        /// @brief Widest instruction set available, detected once on first use.
+        inline SimdLevel simdLevel() noexcept {
+#if defined(FRACLIB_SIMD_DISPATCH)
+            static const SimdLevel level = []() {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) return SimdLevel::Avx512;
+                if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+                return SimdLevel::Scalar;
+            }();
+            return level;
+#elif defined(FRACLIB_SIMD_AVX512)
+            return SimdLevel::Avx512;
+#elif defined(FRACLIB_SIMD_AVX2)
+            return SimdLevel::Avx2;
+#elif defined(FRACLIB_SIMD_NEON)
+            return SimdLevel::Neon;
+#else
+            return SimdLevel::Scalar;
+#endif
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_sort.h
+ * Description:
+ *  This header file defines `sort`, `lower_bound` and `upper_bound` for
+ *  arrays of `Frac` and for `FracArray`.
+ *
+ *  Instead of comparing pairs of fractions, `sort` maps every fraction to
+ *  the fixed-width key `floor(value * 2^shift)`, which orders like
+ *  `Frac::compare`. Distinct fractions with denominators up to `D` differ by
+ *  at least `1/D^2`, so `shift` is chosen as the smallest that makes every
+ *  key exact (at most 31 bits). Past that, fractions closer than `2^-31` can
+ *  share a key and each such run is finished with `Frac::compare`. The keys
+ *  are sorted with a stable LSD radix sort over only the digits the key
+ *  range needs, with the histogram and scatter steps of large arrays split
+ *  across threads.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac.h"
+#include "frac_array.h"
+#include <cstddef>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Sorting
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Both overloads sort ascending by value and are stable: equal values keep their relative order.
+    // Denominators must be non-zero. `threads` is the number of threads to use, `0` for one per
+    // hardware thread; small arrays are always sorted on the calling thread.
+
+    /// @brief Sorts `[first, last)` by value with an exact-key radix sort.
+    /// @example FracLib::sort(values.data(), values.data() + values.size());
+    void sort(Frac* first, Frac* last, unsigned threads = 0);
+    /// @brief Sorts the elements of `array` by value with an exact-key radix sort.
+    /// @example FracLib::sort(prices);
+    void sort(FracArray& array, unsigned threads = 0);
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Searching
+    //\\\\\\\\\\\\\\\\\\\\/
+    // The range must be sorted by value (ie. by `sort`). Values are compared with `Frac::compare`,
+    // so `1/2` and `2/4` are equal.
+
+    /// @brief First element of `[first, last)` that is not less than `value`.
+    /// @example const Frac* it = FracLib::lower_bound(begin, end, Frac(1, 2));
+    const Frac* lower_bound(const Frac* first, const Frac* last, const Frac& value) noexcept;
+    /// @brief First element of `[first, last)` that is greater than `value`.
+    const Frac* upper_bound(const Frac* first, const Frac* last, const Frac& value) noexcept;
+    /// @brief Index of the first element of `array` that is not less than `value` (`array.size()` if none).
+    FracArray::size_type lower_bound(FracArrayView array, const Frac& value) noexcept;
+    /// @brief Index of the first element of `array` that is greater than `value` (`array.size()` if none).
+    FracArray::size_type upper_bound(FracArrayView array, const Frac& value) noexcept;
+}
+
+// Inline only in header-only mode, the archive compiles the definitions in src/frac_sort.cpp
+#ifdef FRACLIB_HEADER_ONLY
+    #include "frac_sort_impl.h"
+#endif
@@ -0,0 +1,284 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_sort_impl.h
+ * Description:
+ *  This header file implements the exact-key radix sort and the binary
+ *  searches declared in `frac_sort.h`.
+ *
+ *  When `FRACLIB_HEADER_ONLY` is defined this file is included by
+ *  `frac_sort.h`. Otherwise `src/frac_sort.cpp` compiles it into the static
+ *  library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include "frac_sort.h"
+#include "frac_parallel.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Arrays shorter than this are sorted with `std::stable_sort`.
+        constexpr std::size_t SORT_MIN_RADIX = 64;
+        /// @brief Smallest number of elements worth a thread of its own.
+        constexpr std::size_t SORT_MIN_CHUNK = 1 << 16;
+        /// @brief Bits per radix digit and number of digits in a 64-bit key.
+        constexpr int SORT_DIGIT_BITS = 11;
+        constexpr int SORT_KEY_DIGITS = (64 + SORT_DIGIT_BITS - 1) / SORT_DIGIT_BITS;
+        constexpr std::size_t SORT_BUCKETS = std::size_t(1) << SORT_DIGIT_BITS;
+
+        /// @brief Order-preserving key of one fraction with the position it came from.
+        /// `key` holds `floor(value * 2^shift) + 2^62`, less the smallest key of the array once sorting starts.
+        struct SortKey {
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+        using SortHistogram = std::array<std::uint32_t, SORT_BUCKETS>;
+
+        /// @brief Number of fraction bits that keeps every pair of distinct fractions with denominators
+        /// up to `maxDenominator` apart: they differ by at least `1 / maxDenominator^2`. Capped at 31,
+        /// beyond which distinct values may share a key and are told apart by `Frac::compare`.
+        FRACLIB_INLINE int sortShift(std::uint32_t maxDenominator) noexcept {
+            int shift = 0;
+            const std::uint64_t square = static_cast<std::uint64_t>(maxDenominator) * maxDenominator;
+            while (shift < 31 && (std::uint64_t(1) << shift) < square) shift++;
+            return shift;
+        }
+
+        /// @brief Computes the key of `n/d`, the whole part followed by `shift` fraction bits.
+        /// The fraction bits are estimated with one `double` division, which is off by at most one,
+        /// and corrected with exact 64-bit products.
+        FRACLIB_INLINE SortKey sortKey(int n, int d, int shift, std::uint32_t index) noexcept {
+            const std::uint32_t magnitude = absToUnsigned(n);
+            std::uint32_t divisor = absToUnsigned(d);
+            if (divisor == 0) divisor = 1; // keeps a zero denominator from trapping
+
+            const std::uint64_t whole = magnitude / divisor;
+            const std::uint64_t rest = static_cast<std::uint64_t>(magnitude % divisor) << shift;
+            std::uint64_t bits = static_cast<std::uint64_t>(static_cast<double>(rest) / static_cast<double>(divisor));
+            if (bits * divisor > rest) bits--;
+            else if ((bits + 1) * divisor <= rest) bits++;
+            const std::uint64_t scaled = (whole << shift) | bits;
+
+            constexpr std::uint64_t BIAS = std::uint64_t(1) << 62;
+            // floor(-x) is -floor(x) - 1 unless x * 2^shift is whole
+            if (n != 0 && ((n < 0) != (d < 0))) return SortKey{BIAS - scaled - (bits * divisor != rest ? 1 : 0), index};
+            return SortKey{BIAS + scaled, index};
+        }
+
+        /// @brief Digit `digit` of a key, `0` being the least significant.
+        FRACLIB_INLINE unsigned sortDigit(const SortKey& key, int digit) noexcept {
+            return static_cast<unsigned>(key.key >> (SORT_DIGIT_BITS * digit)) & static_cast<unsigned>(SORT_BUCKETS - 1);
+        }
+
+        /// @brief Builds the keys of `count` fractions and sorts them with a stable LSD radix sort.
+        /// `numerator(i)` and `denominator(i)` return the parts of element `i`.
+        /// Only the digits needed for the span between the smallest and largest key are sorted, and
+        /// digits that are the same for every key are skipped.
+        /// @param isExact set to true when equal keys always mean equal values.
+        /// @return the keys in ascending order, each holding the index of its element.
+        template <typename Numerator, typename Denominator>
+        std::vector<SortKey> sortKeys(std::size_t count, const Numerator& numerator, const Denominator& denominator,
+            unsigned threads, bool& isExact) {
+            const std::size_t chunks = chunkCount(count, SORT_MIN_CHUNK, threads);
+            const auto chunkBegin = [count, chunks](std::size_t chunk) { return count * chunk / chunks; };
+
+            std::vector<std::uint32_t> maxDenominators(chunks, 0);
+            runChunks(chunks, [&](std::size_t chunk) {
+                std::uint32_t maximum = 0;
+                for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                    maximum = std::max(maximum, absToUnsigned(denominator(i)));
+                }
+                maxDenominators[chunk] = maximum;
+            });
+            const std::uint64_t maxDenominator = *std::max_element(maxDenominators.begin(), maxDenominators.end());
+            const int shift = sortShift(static_cast<std::uint32_t>(maxDenominator));
+            isExact = (std::uint64_t(1) << shift) >= maxDenominator * maxDenominator;
+
+            std::vector<SortKey> keys(count), scratch(count);
+            std::vector<std::uint64_t> minKeys(chunks), maxKeys(chunks);
+            runChunks(chunks, [&](std::size_t chunk) {
+                std::uint64_t minimum = ~std::uint64_t(0), maximum = 0;
+                for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                    keys[i] = sortKey(numerator(i), denominator(i), shift, static_cast<std::uint32_t>(i));
+                    minimum = std::min(minimum, keys[i].key);
+                    maximum = std::max(maximum, keys[i].key);
+                }
+                minKeys[chunk] = minimum;
+                maxKeys[chunk] = maximum;
+            });
+            const std::uint64_t minKey = *std::min_element(minKeys.begin(), minKeys.end());
+            const std::uint64_t span = *std::max_element(maxKeys.begin(), maxKeys.end()) - minKey;
+            int digits = 0;
+            while (digits < SORT_KEY_DIGITS && (span >> (SORT_DIGIT_BITS * digits)) != 0) digits++;
+
+            // A digit's histogram does not depend on the order, so one pass counts every digit
+            // and finds the ones that are the same for all keys
+            std::vector<std::array<SortHistogram, SORT_KEY_DIGITS>> counts(chunks);
+            runChunks(chunks, [&](std::size_t chunk) {
+                std::array<SortHistogram, SORT_KEY_DIGITS>& histograms = counts[chunk];
+                for (SortHistogram& histogram : histograms) histogram.fill(0);
+                for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                    keys[i].key -= minKey;
+                    for (int digit = 0; digit < digits; digit++) histograms[digit][sortDigit(keys[i], digit)]++;
+                }
+            });
+
+            std::vector<SortHistogram> offsets(chunks);
+            for (int digit = 0; digit < digits; digit++) {
+                bool isConstant = false;
+                for (std::size_t bucket = 0; bucket < SORT_BUCKETS && !isConstant; bucket++) {
+                    std::size_t total = 0;
+                    for (std::size_t chunk = 0; chunk < chunks; chunk++) total += counts[chunk][digit][bucket];
+                    isConstant = total == count;
+                }
+                if (isConstant) continue;
+
+                // With several chunks each needs the histogram of its current contents. Offsets are
+                // assigned by (bucket, chunk) so equal digits keep their order across chunks.
+                if (chunks == 1) {
+                    offsets[0] = counts[0][digit];
+                } else {
+                    runChunks(chunks, [&](std::size_t chunk) {
+                        SortHistogram& histogram = offsets[chunk];
+                        histogram.fill(0);
+                        for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) histogram[sortDigit(keys[i], digit)]++;
+                    });
+                }
+                std::uint32_t position = 0;
+                for (std::size_t bucket = 0; bucket < SORT_BUCKETS; bucket++) {
+                    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                        const std::uint32_t bucketCount = offsets[chunk][bucket];
+                        offsets[chunk][bucket] = position;
+                        position += bucketCount;
+                    }
+                }
+                runChunks(chunks, [&](std::size_t chunk) {
+                    SortHistogram& next = offsets[chunk];
+                    for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                        scratch[next[sortDigit(keys[i], digit)]++] = keys[i];
+                    }
+                });
+                keys.swap(scratch);
+            }
+            return keys;
+        }
+
+        /// @brief Calls `fn(begin, end)` for every run of two or more equal keys. Fractions closer
+        /// than `2^-shift` can share a key, so these runs are finished with `Frac::compare`.
+        template <typename Fn>
+        void forEachTie(const std::vector<SortKey>& keys, const Fn& fn) {
+            std::size_t begin = 0;
+            for (std::size_t i = 1; i <= keys.size(); i++) {
+                if (i < keys.size() && keys[i].key == keys[begin].key) continue;
+                if (i - begin > 1) fn(begin, i);
+                begin = i;
+            }
+        }
+
+        FRACLIB_INLINE bool lessByValue(const Frac& a, const Frac& b) noexcept {
+            return Frac::compare(a, b) < 0;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Sorting
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void sort(Frac* first, Frac* last, unsigned threads) {
+        const std::size_t count = static_cast<std::size_t>(last - first);
+        if (count < detail::SORT_MIN_RADIX || count > std::numeric_limits<std::uint32_t>::max()) {
+            std::stable_sort(first, last, detail::lessByValue);
+            return;
+        }
+
+        const auto numerator = [first](std::size_t i) { return first[i].numerator; };
+        const auto denominator = [first](std::size_t i) { return first[i].denominator; };
+        bool isExact = false;
+        const std::vector<detail::SortKey> keys = detail::sortKeys(count, numerator, denominator, threads, isExact);
+        std::vector<Frac> sorted(count);
+        for (std::size_t i = 0; i < count; i++) sorted[i] = first[keys[i].index];
+        if (!isExact) detail::forEachTie(keys, [&sorted](std::size_t begin, std::size_t end) {
+            std::stable_sort(sorted.begin() + begin, sorted.begin() + end, detail::lessByValue);
+        });
+        std::memcpy(first, sorted.data(), count * sizeof(Frac));
+    }
+
+    FRACLIB_INLINE void sort(FracArray& array, unsigned threads) {
+        const std::size_t count = array.size();
+        int* numerators = array.numerators();
+        int* denominators = array.denominators();
+        if (count < detail::SORT_MIN_RADIX || count > std::numeric_limits<std::uint32_t>::max()) {
+            std::vector<Frac> values(count);
+            for (std::size_t i = 0; i < count; i++) values[i] = array.get(i);
+            std::stable_sort(values.begin(), values.end(), detail::lessByValue);
+            for (std::size_t i = 0; i < count; i++) array.set(i, values[i]);
+            return;
+        }
+
+        const auto numerator = [numerators](std::size_t i) { return numerators[i]; };
+        const auto denominator = [denominators](std::size_t i) { return denominators[i]; };
+        bool isExact = false;
+        std::vector<detail::SortKey> keys = detail::sortKeys(count, numerator, denominator, threads, isExact);
+        if (!isExact) detail::forEachTie(keys, [&](std::size_t begin, std::size_t end) {
+            std::stable_sort(keys.begin() + begin, keys.begin() + end, [&](const detail::SortKey& a, const detail::SortKey& b) {
+                return detail::lessByValue(array.get(a.index), array.get(b.index));
+            });
+        });
+        std::pmr::vector<int> sorted(count, 0, array.resource());
+        for (std::size_t i = 0; i < count; i++) sorted[i] = numerators[keys[i].index];
+        std::memcpy(numerators, sorted.data(), count * sizeof(int));
+        for (std::size_t i = 0; i < count; i++) sorted[i] = denominators[keys[i].index];
+        std::memcpy(denominators, sorted.data(), count * sizeof(int));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Searching
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE const Frac* lower_bound(const Frac* first, const Frac* last, const Frac& value) noexcept {
+        return std::lower_bound(first, last, value, detail::lessByValue);
+    }
+
+    FRACLIB_INLINE const Frac* upper_bound(const Frac* first, const Frac* last, const Frac& value) noexcept {
+        return std::upper_bound(first, last, value, detail::lessByValue);
+    }
+
+    FRACLIB_INLINE FracArray::size_type lower_bound(FracArrayView array, const Frac& value) noexcept {
+        FracArray::size_type low = 0, high = array.size();
+        while (low < high) {
+            const FracArray::size_type middle = low + (high - low) / 2;
+            if (Frac::compare(array.get(middle), value) < 0) low = middle + 1;
+            else high = middle;
+        }
+        return low;
+    }
+
+    FRACLIB_INLINE FracArray::size_type upper_bound(FracArrayView array, const Frac& value) noexcept {
+        FracArray::size_type low = 0, high = array.size();
+        while (low < high) {
+            const FracArray::size_type middle = low + (high - low) / 2;
+            if (Frac::compare(value, array.get(middle)) < 0) high = middle;
+            else low = middle + 1;
+        }
+        return low;
+    }
+}
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_stats.h
+ * Description:
+ *  This header file defines `FracStats`, the opt-in hot-path counters of
+ *  FracLib, and the `FRACLIB_COUNT` macro the library uses to bump them.
+ *
+ *  Counting is compiled in only when `FRACLIB_STATS` is defined (the CMake
+ *  option of the same name defines it for the library and its users, and
+ *  every translation unit must agree). Each thread has its own counters, so
+ *  counting is a plain increment with no atomics or locks. Without
+ *  `FRACLIB_STATS` the macro expands to nothing, and `stats()` always
+ *  returns zeros.
+ *
+ *  Counting is skipped during constant evaluation, so the `constexpr`
+ *  arithmetic still works in constant expressions.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#ifdef FRACLIB_STATS
+    #if defined(__cpp_lib_is_constant_evaluated)
+        #define FRACLIB_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+    #elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+        #define FRACLIB_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #else
+        #error "FRACLIB_STATS needs std::is_constant_evaluated or __builtin_is_constant_evaluated"
+    #endif
+#endif
+
+namespace FracLib {
+    /// @brief Counters of the calling thread, see `stats()`.
+    struct FracStats {
+        std::uint64_t operations = 0;       ///< `tryAdd`, `trySub`, `tryMul`, `tryDiv`, `tryFma` and `tryDot2` calls, which the operators go through.
+        std::uint64_t simplifications = 0;  ///< `trySimplify` calls. SIMD lanes of the batch kernels are not counted, lanes that fall back to scalar code are.
+        std::uint64_t gcdCalls = 0;         ///< Binary GCDs of two non-zero values.
+        std::uint64_t gcdIterations = 0;    ///< Subtraction steps of those GCDs.
+        std::uint64_t overflows = 0;        ///< Checked multiplications, additions or subtractions that overflowed, and reduced results too wide to narrow.
+        std::uint64_t conversions = 0;      ///< Fractions built from a `float` or a string, including the temporaries of mixed operators that miss the conversion cache.
+        std::uint64_t parses = 0;           ///< `fromChars` and `tryParseDecimal` calls, which every text parser goes through.
+        std::uint64_t parsedBytes = 0;      ///< Characters consumed by those parses.
+        std::uint64_t formats = 0;          ///< `toChars` calls, which `toString`, `toCharsBulk` and `operator<<` go through.
+        std::uint64_t formattedBytes = 0;   ///< Characters written by those calls.
+
+        /// @brief Adds the counters of `other`, ie. to combine the snapshots of several threads.
+        constexpr FracStats& operator+=(const FracStats& other) noexcept {
+            this->operations += other.operations;
+            this->simplifications += other.simplifications;
+            this->gcdCalls += other.gcdCalls;
+            this->gcdIterations += other.gcdIterations;
+            this->overflows += other.overflows;
+            this->conversions += other.conversions;
+            this->parses += other.parses;
+            this->parsedBytes += other.parsedBytes;
+            this->formats += other.formats;
+            this->formattedBytes += other.formattedBytes;
+            return *this;
+        }
+
+        /// @brief Calls `fn(name, value)` for every counter, in declaration order, for exporting to a metrics system.
+        /// @example stats.forEach([](const char* name, std::uint64_t value) { gauge(name).set(value); });
+        template <typename Fn>
+        constexpr void forEach(Fn fn) const {
+            fn("operations", this->operations);
+            fn("simplifications", this->simplifications);
+            fn("gcd_calls", this->gcdCalls);
+            fn("gcd_iterations", this->gcdIterations);
+            fn("overflows", this->overflows);
+            fn("conversions", this->conversions);
+            fn("parses", this->parses);
+            fn("parsed_bytes", this->parsedBytes);
+            fn("formats", this->formats);
+            fn("formatted_bytes", this->formattedBytes);
+        }
+    };
+
+    /// @brief True when the library was built with `FRACLIB_STATS`.
+#ifdef FRACLIB_STATS
+    constexpr bool STATS_ENABLED = true;
+#else
+    constexpr bool STATS_ENABLED = false;
+#endif
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+#ifdef FRACLIB_STATS
+        /// @brief Counters of the current thread.
+        inline thread_local FracStats threadStats;
+#endif
+
+        /// @brief Returns `isOverflow`, counting it in `FracStats::overflows` when true.
+        constexpr bool countOverflow(bool isOverflow) noexcept {
+#ifdef FRACLIB_STATS
+            if (isOverflow && !FRACLIB_IS_CONSTANT_EVALUATED()) threadStats.overflows++;
+#endif
+            return isOverflow;
+        }
+    }
+
+    /// @brief Adds `amount` to the `FracStats` member `counter` of the current thread. Does nothing during
+    /// constant evaluation or without `FRACLIB_STATS`, in which case `amount` is not evaluated.
+#ifdef FRACLIB_STATS
+    #define FRACLIB_COUNT(counter, amount) \
+        do { if (!FRACLIB_IS_CONSTANT_EVALUATED()) ::FracLib::detail::threadStats.counter += (amount); } while (0)
+#else
+    #define FRACLIB_COUNT(counter, amount) do {} while (0)
+#endif
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Snapshot
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Counters are per thread: work done on the worker threads of the parallel reductions, sorts and
+    // ingestion is counted on those threads, not on the caller.
+
+    /// @brief Returns a copy of the counters of the calling thread, all zero without `FRACLIB_STATS`.
+    /// @example FracLib::FracStats before = FracLib::stats(); run(); FracLib::FracStats after = FracLib::stats();
+    inline FracStats stats() noexcept {
+#ifdef FRACLIB_STATS
+        return detail::threadStats;
+#else
+        return FracStats();
+#endif
+    }
+
+    /// @brief Sets every counter of the calling thread back to zero.
+    inline void resetStats() noexcept {
+#ifdef FRACLIB_STATS
+        detail::threadStats = FracStats();
+#endif
+    }
+}
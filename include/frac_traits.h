@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_traits.h
+ * Description:
+ *  This header file defines the integer traits used by `BasicFrac<IntT>`.
+ *  For every supported storage type it names the widened type used for
+ *  intermediate products, the matching unsigned type (used for magnitudes
+ *  and GCD), and the value range. `__int128` is supported on compilers that
+ *  provide it, even in strict ISO mode where the standard library traits
+ *  do not recognise it.
+ *
+ *  This file is included by `frac.h` and should not be included directly.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SIZEOF_INT128__)
+    #define FRACLIB_HAS_INT128 1
+#endif
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Maps a storage width (in bytes) to the types used for its intermediate values.
+        /// `Wide` is the type cross products are computed in. When no wider type exists the
+        /// storage type is reused and overflow is detected at that width instead.
+        template <std::size_t Bytes> struct WidthTraits;
+
+        template <> struct WidthTraits<4> {
+            using Wide = std::int64_t;
+            using Unsigned = std::uint32_t;
+        };
+
+#ifdef FRACLIB_HAS_INT128
+        template <> struct WidthTraits<8> {
+            using Wide = __int128;
+            using Unsigned = std::uint64_t;
+        };
+
+        template <> struct WidthTraits<16> {
+            using Wide = __int128;
+            using Unsigned = unsigned __int128;
+        };
+#else
+        template <> struct WidthTraits<8> {
+            using Wide = std::int64_t;
+            using Unsigned = std::uint64_t;
+        };
+#endif
+
+        /// @brief Integer traits for a signed storage type of `BasicFrac`.
+        template <typename IntT>
+        struct IntTraits : WidthTraits<sizeof(IntT)> {
+            static constexpr int digits = static_cast<int>(sizeof(IntT) * 8 - 1);
+            /// @brief Maximum number of base 10 digits of a value, excluding the sign.
+            static constexpr int decimalDigits = static_cast<int>(static_cast<long>(digits) * 30103 / 100000 + 1);
+            // Built without shifting into the sign bit so it is valid for every width.
+            static constexpr IntT max = static_cast<IntT>(((static_cast<IntT>(1) << (digits - 1)) - 1) * 2 + 1);
+            static constexpr IntT min = static_cast<IntT>(-max - 1);
+            /// @brief True when `Wide` can hold any product of two `IntT` values.
+            static constexpr bool isWidened = sizeof(typename WidthTraits<sizeof(IntT)>::Wide) > sizeof(IntT);
+        };
+
+        /// @brief True for the signed integer types `BasicFrac` can store.
+        template <typename T> struct IsFracInt {
+            static constexpr bool value = std::is_integral<T>::value && std::is_signed<T>::value &&
+                (sizeof(T) == 4 || sizeof(T) == 8);
+        };
+
+#ifdef FRACLIB_HAS_INT128
+        template <> struct IsFracInt<__int128> {
+            static constexpr bool value = true;
+        };
+#endif
+
+        /// @brief Enables the integer scalar overloads of `BasicFrac` for any integer type except `bool`.
+        /// Taking the scalar as a template parameter keeps `Frac64 + 1` from being ambiguous with the `float` overloads.
+        template <typename T>
+        using EnableIfInteger = std::enable_if_t<(std::is_integral<T>::value || IsFracInt<T>::value) && !std::is_same<T, bool>::value>;
+
+        /// @brief Returns true if `value` is representable as `IntT`.
+        template <typename IntT, typename T>
+        constexpr bool fitsIn(T value) {
+            if constexpr (static_cast<T>(-1) > static_cast<T>(0)) {
+                return value <= static_cast<typename IntTraits<IntT>::Unsigned>(IntTraits<IntT>::max);
+            } else if constexpr (sizeof(T) <= sizeof(IntT)) {
+                return true;
+            } else {
+                return value >= static_cast<T>(IntTraits<IntT>::min) && value <= static_cast<T>(IntTraits<IntT>::max);
+            }
+        }
+
+        /// @brief Magnitude of a signed value as its unsigned counterpart (well defined for the minimum value).
+        template <typename T>
+        constexpr typename IntTraits<T>::Unsigned absToUnsigned(T value) {
+            using Unsigned = typename IntTraits<T>::Unsigned;
+            return value < 0 ? static_cast<Unsigned>(static_cast<Unsigned>(0) - static_cast<Unsigned>(value))
+                             : static_cast<Unsigned>(value);
+        }
+    }
+}
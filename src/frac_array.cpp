@@ -0,0 +1,25 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_array.cpp
+ * Description:
+ *  This source file compiles the `FracArray` container and its batch kernels
+ *  into the static library. The kernels use the instruction set enabled for
+ *  this translation unit (see `frac_simd.h`).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "../include/frac_array.h"
+
+// In header-only mode every definition already lives in the headers.
+#ifndef FRACLIB_HEADER_ONLY
+#include "../include/frac_array_impl.h"
+#endif
@@ -0,0 +1,24 @@
+/******************************************************************************
+ * Project: FracLib
+ * File: frac_bigint.cpp
+ * Description:
+ *  This source file compiles the `BigInt` limb arithmetic of `frac_bigint.h`
+ *  into the static library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0
+ * Author: Ghost
+ * Created On: 10-14-2026
+ * Last Modified: 10-14-2026
+ *****************************************************************************/
+
+#include "../include/frac_bigint.h"
+
+// In header-only mode every definition already lives in the headers.
+#ifndef FRACLIB_HEADER_ONLY
+#include "../include/frac_bigint_impl.h"
+#endif